@@ -0,0 +1,91 @@
+// K-d Tree
+//
+// Static 2D tree over pt from geo_int.cpp or geo_double.cpp (include one first).
+// Implicit layout: the node of range [l, r) lives at m = (l+r)/2, with its
+// bounding box in b[m]; it splits on the wider side of the box (nth_element).
+// knn(q, k) returns the min(k, N) closest {dist_sq, pt}, increasing (empty if k <= 0)
+// nearest(q) = knn(q, 1)[0], requires N > 0
+// count / report take the rectangle [x1, x2] x [y1, y2]
+//
+// complexity: build O(N log N); NN O(log N) expected on random-like data,
+// rectangle O(sqrt N + K); O(N)
+
+struct kdtree {
+    using C = decltype(pt::x);
+    struct box { C x1, y1, x2, y2; };
+    ll n;
+    vector<pt> p;
+    vector<box> b;
+    vector<char> d;
+
+    kdtree(vector<pt> v) : n(sz(v)), p(v), b(n), d(n) { build(0, n); }
+
+    static C get(const pt& a, bool k) { return k ? a.y : a.x; }
+
+    void build(ll l, ll r) {
+        if (l >= r) return;
+        ll m = (l + r) / 2;
+        box& B = b[m];
+        B = {p[l].x, p[l].y, p[l].x, p[l].y};
+        forn(i, l+1, r) {
+            B.x1 = min(B.x1, p[i].x), B.x2 = max(B.x2, p[i].x);
+            B.y1 = min(B.y1, p[i].y), B.y2 = max(B.y2, p[i].y);
+        }
+        d[m] = B.y2 - B.y1 > B.x2 - B.x1;
+        bool k = d[m];
+        nth_element(p.begin() + l, p.begin() + m, p.begin() + r,
+            [&](const pt& x, const pt& y) { return get(x, k) < get(y, k); });
+        build(l, m), build(m+1, r);
+    }
+
+    static C box_dist(const box& B, const pt& q) {
+        C dx = max({C(0), B.x1 - q.x, q.x - B.x2});
+        C dy = max({C(0), B.y1 - q.y, q.y - B.y2});
+        return dx*dx + dy*dy;
+    }
+
+    void knn(ll l, ll r, const pt& q, ll k, priority_queue<pair<C, ll>>& h) {
+        if (l >= r) return;
+        ll m = (l + r) / 2;
+        if (sz(h) == k && box_dist(b[m], q) >= h.top().first) return;
+        C dd = dist_sq(p[m], q);
+        if (sz(h) < k) h.push({dd, m});
+        else if (dd < h.top().first) h.pop(), h.push({dd, m});
+        if (get(q, d[m]) < get(p[m], d[m])) knn(l, m, q, k, h), knn(m+1, r, q, k, h);
+        else knn(m+1, r, q, k, h), knn(l, m, q, k, h);
+    }
+    vector<pair<C, pt>> knn(pt q, ll k) {
+        priority_queue<pair<C, ll>> h;
+        if (k > 0) knn(0, n, q, k, h);
+        vector<pair<C, pt>> ret;
+        for (; sz(h); h.pop()) ret.push_back({h.top().first, p[h.top().second]});
+        reverse(ret.begin(), ret.end());
+        return ret;
+    }
+    pair<C, pt> nearest(pt q) { // requer n > 0
+        assert(n > 0);
+        return knn(q, 1)[0];
+    }
+
+    template<class F> ll rect(ll l, ll r, const box& R, F&& f) {
+        if (l >= r) return 0;
+        ll m = (l + r) / 2;
+        const box& B = b[m];
+        if (B.x2 < R.x1 || R.x2 < B.x1 || B.y2 < R.y1 || R.y2 < B.y1) return 0;
+        if (R.x1 <= B.x1 && B.x2 <= R.x2 && R.y1 <= B.y1 && B.y2 <= R.y2) {
+            forn(i, l, r) f(p[i]);
+            return r - l;
+        }
+        ll c = 0;
+        if (R.x1 <= p[m].x && p[m].x <= R.x2 && R.y1 <= p[m].y && p[m].y <= R.y2) f(p[m]), c++;
+        return c + rect(l, m, R, f) + rect(m+1, r, R, f);
+    }
+    ll count(C x1, C y1, C x2, C y2) {
+        return rect(0, n, {x1, y1, x2, y2}, [](const pt&) {});
+    }
+    vector<pt> report(C x1, C y1, C x2, C y2) {
+        vector<pt> ret;
+        rect(0, n, {x1, y1, x2, y2}, [&](const pt& a) { ret.push_back(a); });
+        return ret;
+    }
+};
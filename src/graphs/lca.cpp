@@ -13,9 +13,9 @@
 struct LCA {
 	ll T = 0;
 	vll time, path, ret, dep;
-	sparse rmq;
+	sparse<> st;
 
-	LCA(vector<vll>& C, ll root) : time(sz(C)), dep(sz(C)), rmq((dfs(C,root,-1), ret)) {}
+	LCA(vector<vll>& C, ll root) : time(sz(C)), dep(sz(C)), st((dfs(C,root,-1), ret)) {}
 	void dfs(vector<vll>& C, ll v, ll par) {
 		time[v] = T++;
         if(par != -1) dep[v] = dep[par] + 1;            
@@ -28,7 +28,7 @@ struct LCA {
 	ll lca(ll a, ll b) {
 		if (a == b) return a;
 		tie(a, b) = minmax(time[a], time[b]);
-		return path[rmq.query(a, b-1)];
+		return path[st.query(a, b-1)];
 	}
 	ll dist(ll a,ll b){return dep[a] + dep[b] - 2*dep[lca(a,b)];}
 };
@@ -1,34 +1,36 @@
 // Fenwick Tree with Range Updates
 //
 // Implements a pair of BITs to support 0-based range add updates and range sum queries efficiently.
+// Both BITs are interleaved (bit[i][0], bit[i][1]) so every step of a walk reads one cache line.
+// Sized to n and allocator-aware: to build many small trees, hand them a shared pool
+//   pmr::monotonic_buffer_resource pool;
+//   BIT<> t(n, &pool);
 //
 // complexity: O(log N) per op, O(N)
 
-class BIT{
-    ll bit[2][MAX+2];
+template<typename T = ll> struct BIT {
     ll n;
-public:
-    BIT(ll n2, vll& v) {
-        n = n2;
+    pmr::vector<array<T, 2>> bit;
+
+    BIT(ll n2, pmr::memory_resource* mr = pmr::get_default_resource())
+        : n(n2), bit(n+2, array<T, 2>{}, mr) {}
+    BIT(ll n2, vector<T>& v, pmr::memory_resource* mr = pmr::get_default_resource())
+        : BIT(n2, mr) {
         for (ll i = 1; i <= n; i++)
-            bit[1][min(n+1, i+(i&-i))] += bit[1][i] += v[i-1];
-    }
-    ll get(ll x, ll i) {
-        ll ret = 0;
-        for (; i; i -= i&-i) ret += bit[x][i];
-        return ret;
+            bit[min(n+1, i+(i&-i))][1] += bit[i][1] += v[i-1];
     }
-    void add(ll x, ll i, ll val) {
-        for (; i <= n; i += i&-i) bit[x][i] += val;
+    T get2(ll p) {
+        T a = 0, b = 0;
+        for (ll i = p; i; i -= i&-i) a += bit[i][0], b += bit[i][1];
+        return a * p + b;
     }
-    ll get2(ll p) {
-        return get(0, p) * p + get(1, p);
+    void add(ll i, T x, T y) {
+        for (; i <= n; i += i&-i) bit[i][0] += x, bit[i][1] += y;
     }
-    ll query(ll l, ll r) {
+    T query(ll l, ll r) {
         return get2(r+1) - get2(l);
     }
-    void update(ll l, ll r, ll x) {
-        add(0, l+1, x), add(0, r+2, -x);
-        add(1, l+1, -x*l), add(1, r+2, x*(r+1));
+    void update(ll l, ll r, T x) {
+        add(l+1, x, -x*l), add(r+2, -x, x*(r+1));
     }
-}
+};
@@ -0,0 +1,38 @@
+// Fenwick Tree 2D with Range Updates
+//
+// Rectangle add and rectangle sum on an n x m grid, 0-based and inclusive.
+// Keeps the four BITs of d, d*i, d*j and d*i*j interleaved in one flat buffer.
+// Same pooling as bit_range.cpp: BIT2D<> t(n, m, &pool);
+//
+// complexity: O(log N log M) per op, O(NM)
+
+template<typename T = ll> struct BIT2D {
+    ll n, m;
+    pmr::vector<array<T, 4>> bit;
+
+    BIT2D(ll n2, ll m2, pmr::memory_resource* mr = pmr::get_default_resource())
+        : n(n2), m(m2), bit((n+1)*(m+1), array<T, 4>{}, mr) {}
+    void add(ll x, ll y, T v) {
+        for (ll i = x; i <= n; i += i&-i)
+            for (ll j = y; j <= m; j += j&-j) {
+                auto& b = bit[i*(m+1) + j];
+                b[0] += v, b[1] += v*x, b[2] += v*y, b[3] += v*x*y;
+            }
+    }
+    T get(ll x, ll y) { // soma de [0, x) x [0, y)
+        array<T, 4> s{};
+        for (ll i = x; i; i -= i&-i)
+            for (ll j = y; j; j -= j&-j) {
+                auto& b = bit[i*(m+1) + j];
+                forn(k, 0, 4) s[k] += b[k];
+            }
+        return s[0]*(x+1)*(y+1) - s[1]*(y+1) - s[2]*(x+1) + s[3];
+    }
+    T query(ll x1, ll y1, ll x2, ll y2) {
+        return get(x2+1, y2+1) - get(x1, y2+1) - get(x2+1, y1) + get(x1, y1);
+    }
+    void update(ll x1, ll y1, ll x2, ll y2, T v) {
+        add(x1+1, y1+1, v), add(x1+1, y2+2, -v);
+        add(x2+2, y1+1, -v), add(x2+2, y2+2, v);
+    }
+};
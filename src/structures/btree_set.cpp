@@ -0,0 +1,181 @@
+// Order-Statistic B+ Tree
+//
+// Sorted set without pb_ds: keys live in leaves of up to B sorted keys; inner nodes keep,
+// per child, its max key and subtree size. Nodes sit in two arenas (vectors) and are
+// reused after erase. Erase does not rebalance (leaves may become underfull, empty nodes
+// are removed), so after many erases rebuild with build(sorted unique keys).
+// find_by_order(k): k-th smallest (0-based); order_of_key(x): keys < x;
+// lower_bound(x): pointer to the smallest key >= x, or nullptr (valid until next change)
+//
+// complexity: O(B log_B N) per op, O(N)
+
+template<typename T, ll B = 32> struct btree_set {
+    struct leaf { ll n = 0; T k[B+1]; };
+    struct inner { ll n = 0; T mx[B+1]; uint32_t ch[B+1]; ll c[B+1]; };
+    vector<leaf> lf;
+    vector<inner> in;
+    vector<uint32_t> free_lf, free_in;
+    uint32_t root;
+    ll h = 0, total = 0; // folhas ficam na profundidade h
+
+    btree_set() { root = new_leaf(); }
+    btree_set(const vector<T>& v) { build(v); }
+
+    uint32_t new_leaf() {
+        if (free_lf.empty()) { lf.emplace_back(); return sz(lf) - 1; }
+        uint32_t x = free_lf.back(); free_lf.pop_back();
+        lf[x].n = 0;
+        return x;
+    }
+    uint32_t new_inner() {
+        if (free_in.empty()) { in.emplace_back(); return sz(in) - 1; }
+        uint32_t x = free_in.back(); free_in.pop_back();
+        in[x].n = 0;
+        return x;
+    }
+    ll cnt(uint32_t x, ll d) {
+        if (d == h) return lf[x].n;
+        return accumulate(in[x].c, in[x].c + in[x].n, 0ll);
+    }
+    T max_of(uint32_t x, ll d) { return d == h ? lf[x].k[lf[x].n - 1] : in[x].mx[in[x].n - 1]; }
+    ll route(inner& I, const T& v) { return std::lower_bound(I.mx, I.mx + I.n, v) - I.mx; }
+
+    void build(const vector<T>& v) { // v ordenado e sem repetidos
+        lf.clear(), in.clear(), free_lf.clear(), free_in.clear();
+        total = sz(v), h = 0;
+        vector<uint32_t> level;
+        for (ll i = 0; i < sz(v) || level.empty(); i += B) {
+            uint32_t x = new_leaf();
+            lf[x].n = min(B, sz(v) - i);
+            copy(v.begin() + i, v.begin() + i + lf[x].n, lf[x].k);
+            level.push_back(x);
+        }
+        for (bool leaves = true; sz(level) > 1; leaves = false, h++) {
+            vector<uint32_t> up;
+            for (ll i = 0; i < sz(level); i += B) {
+                uint32_t x = new_inner();
+                inner& I = in[x];
+                for (ll j = i; j < min(sz(level), i + B); j++, I.n++) {
+                    uint32_t c = level[j];
+                    I.ch[I.n] = c;
+                    I.mx[I.n] = leaves ? lf[c].k[lf[c].n - 1] : in[c].mx[in[c].n - 1];
+                    I.c[I.n] = leaves ? lf[c].n : accumulate(in[c].c, in[c].c + in[c].n, 0ll);
+                }
+                up.push_back(x);
+            }
+            level = up;
+        }
+        root = level[0];
+    }
+
+    // insere v abaixo de x (profundidade d); retorna o novo irmao a direita, ou -1
+    ll ins(uint32_t x, ll d, const T& v, bool& ok) {
+        if (d == h) {
+            leaf& L = lf[x];
+            ll p = std::lower_bound(L.k, L.k + L.n, v) - L.k;
+            if (p < L.n && !(v < L.k[p])) return ok = false, -1;
+            ok = true;
+            copy_backward(L.k + p, L.k + L.n, L.k + L.n + 1);
+            L.k[p] = v, L.n++;
+            if (L.n <= B) return -1;
+            uint32_t y = new_leaf();
+            leaf &A = lf[x], &C = lf[y];
+            C.n = A.n - A.n / 2, A.n /= 2;
+            copy(A.k + A.n, A.k + A.n + C.n, C.k);
+            return y;
+        }
+        ll p = min(route(in[x], v), in[x].n - 1);
+        ll s = ins(in[x].ch[p], d + 1, v, ok);
+        if (!ok) return -1;
+        inner& I = in[x];
+        I.c[p]++, I.mx[p] = max_of(I.ch[p], d + 1);
+        if (s < 0) return -1;
+        for (ll i = I.n; i > p + 1; i--) I.ch[i] = I.ch[i-1], I.mx[i] = I.mx[i-1], I.c[i] = I.c[i-1];
+        I.ch[p+1] = s, I.mx[p+1] = max_of(s, d + 1), I.c[p+1] = cnt(s, d + 1);
+        I.c[p] -= I.c[p+1], I.mx[p] = max_of(I.ch[p], d + 1);
+        if (++I.n <= B) return -1;
+        uint32_t y = new_inner();
+        inner &A = in[x], &C = in[y];
+        C.n = A.n - A.n / 2, A.n /= 2;
+        forn(i, 0, C.n) C.ch[i] = A.ch[A.n + i], C.mx[i] = A.mx[A.n + i], C.c[i] = A.c[A.n + i];
+        return y;
+    }
+    bool insert(const T& v) {
+        bool ok;
+        ll s = ins(root, 0, v, ok);
+        if (s >= 0) { // raiz dividiu: nova raiz com os dois filhos
+            uint32_t r = new_inner();
+            in[r].n = 2, in[r].ch[0] = root, in[r].ch[1] = s;
+            root = r, h++;
+            forn(i, 0, 2) in[r].mx[i] = max_of(in[r].ch[i], 1), in[r].c[i] = cnt(in[r].ch[i], 1);
+        }
+        if (ok) total++;
+        return ok;
+    }
+
+    bool del(uint32_t x, ll d, const T& v) {
+        if (d == h) {
+            leaf& L = lf[x];
+            ll p = std::lower_bound(L.k, L.k + L.n, v) - L.k;
+            if (p == L.n || v < L.k[p]) return false;
+            copy(L.k + p + 1, L.k + L.n, L.k + p), L.n--;
+            return true;
+        }
+        ll p = route(in[x], v);
+        if (p == in[x].n || !del(in[x].ch[p], d + 1, v)) return false;
+        inner& I = in[x];
+        if (--I.c[p]) { I.mx[p] = max_of(I.ch[p], d + 1); return true; }
+        (d + 1 == h ? free_lf : free_in).push_back(I.ch[p]);
+        for (ll i = p; i + 1 < I.n; i++) I.ch[i] = I.ch[i+1], I.mx[i] = I.mx[i+1], I.c[i] = I.c[i+1];
+        I.n--;
+        return true;
+    }
+    bool erase(const T& v) {
+        if (!del(root, 0, v)) return false;
+        total--;
+        while (h && in[root].n <= 1) {
+            free_in.push_back(root);
+            if (in[root].n == 0) { root = new_leaf(), h = 0; break; }
+            root = in[root].ch[0], h--;
+        }
+        return true;
+    }
+
+    ll size() { return total; }
+    ll order_of_key(const T& v) {
+        uint32_t x = root;
+        ll ret = 0;
+        for (ll d = 0; d < h; d++) {
+            inner& I = in[x];
+            ll p = route(I, v);
+            ret += accumulate(I.c, I.c + p, 0ll);
+            if (p == I.n) return ret;
+            x = I.ch[p];
+        }
+        return ret + (std::lower_bound(lf[x].k, lf[x].k + lf[x].n, v) - lf[x].k);
+    }
+    T find_by_order(ll k) { // requer 0 <= k < size()
+        uint32_t x = root;
+        for (ll d = 0; d < h; d++) {
+            inner& I = in[x];
+            ll p = 0;
+            while (k >= I.c[p]) k -= I.c[p++];
+            x = I.ch[p];
+        }
+        return lf[x].k[k];
+    }
+    T* lower_bound(const T& v) {
+        uint32_t x = root;
+        for (ll d = 0; d < h; d++) {
+            ll p = route(in[x], v);
+            if (p == in[x].n) return nullptr;
+            x = in[x].ch[p];
+        }
+        T* p = std::lower_bound(lf[x].k, lf[x].k + lf[x].n, v);
+        return p == lf[x].k + lf[x].n ? nullptr : p;
+    }
+    bool count(const T& v) {
+        T* p = lower_bound(v);
+        return p && !(v < *p);
+    }
+};
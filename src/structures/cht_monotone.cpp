@@ -0,0 +1,38 @@
+// Convex Hull Trick Monotono
+//
+// add(a, b) adiciona reta ax + b, com a nao decrescente
+// query(x) computa maximo de ax + b, com x nao decrescente entre as queries
+// Retas num vetor (sem alocacao por reta), ponteiro do inicio so avanca
+// bad() compara produtos de diferencas no tipo W: T = ll com W = __int128 e
+// seguro para |a|, |b| <= 1e18 (a avaliacao ax + b ainda e feita em T)
+// Para T ponto flutuante use W = T (ex.: mono_cht<ld, ld>)
+//
+// O(1) amortizado por insercao e por query
+
+template<typename T = ll, typename W = __int128> struct mono_cht {
+    struct line {
+        T a, b;
+        T operator()(T x) const { return a * x + b; }
+    };
+    vector<line> L;
+    ll h = 0;
+
+    bool bad(const line& l1, const line& l2, const line& l3) { // l2 nunca e maxima
+        return ((W)l1.b - l2.b) * ((W)l3.a - l2.a) >= ((W)l2.b - l3.b) * ((W)l2.a - l1.a);
+    }
+
+    void add(T a, T b) {
+        if (sz(L) > h && L.back().a == a) {
+            if (L.back().b >= b) return;
+            L.pop_back();
+        }
+        while (sz(L) - h >= 2 && bad(L[sz(L)-2], L.back(), {a, b})) L.pop_back();
+        L.push_back({a, b});
+    }
+
+    T query(T x) {
+        assert(sz(L) > h);
+        while (h + 1 < sz(L) && L[h+1](x) >= L[h](x)) h++;
+        return L[h](x);
+    }
+};
@@ -0,0 +1,36 @@
+// Disjoint Sparse Table
+//
+// O(1) range queries for any associative combine, idempotent or not (sum, product, mint,
+// matrices), using the node convention of segtree.cpp: T::comb(a, b), order preserved.
+// Level h splits the array into blocks of 2^h; m[h*n + i] holds the suffix (left half)
+// or prefix (right half) of i's block up to its middle, so [l, r] is answered by the
+// level of the highest differing bit of l and r with exactly one comb.
+//
+// complexity: O(N log N) build, O(1) query; O(N log N) space
+
+template<typename T> struct disjoint_sparse {
+    ll n, lg;
+    vector<T> m;
+
+    disjoint_sparse(vector<T>& v) : n(sz(v)) {
+        lg = 1;
+        while ((1ll << lg) < n) lg++;
+        m.resize((lg + 1) * n);
+        copy(v.begin(), v.end(), m.begin());
+        for (ll h = 1; h <= lg; h++) {
+            T* c = &m[h * n];
+            for (ll mid = 1ll << (h-1); mid < n; mid += 1ll << h) {
+                c[mid-1] = v[mid-1];
+                for (ll i = mid-2; i >= mid - (1ll << (h-1)); i--) c[i] = T::comb(v[i], c[i+1]);
+                c[mid] = v[mid];
+                for (ll i = mid+1; i < min(n, mid + (1ll << (h-1))); i++) c[i] = T::comb(c[i-1], v[i]);
+            }
+        }
+    }
+
+    T query(ll l, ll r) {
+        if (l == r) return m[l];
+        ll h = 64 - __builtin_clzll(l ^ r);
+        return T::comb(m[h*n + l], m[h*n + r]);
+    }
+};
@@ -1,21 +1,37 @@
 // Disjoint Set Union (Union-Find)
 //
 // Supports find with path compression and union by size to maintain dynamic connectivity of disjoint sets.
+// p[a] < 0 marks a root of size -p[a] (one 32-bit array); find is iterative with path halving.
+// reset() only clears the entries touched since the last reset, for reuse across many tests.
+// Potentials (val[b] - val[a] = d): dsu_weighted.cpp.
 //
 // complexity: O(alpha(N)) amortized per op, O(N)
 
 struct dsu {
-    vll id, len;
+    vector<int> p, touched;
+    ll comps;
 
-    dsu(ll n) : id(n), len(n, 1) { iota(id.begin(), id.end(), 0); }
-
-    ll find(ll a) { return a == id[a] ? a : id[a] = find(id[a]); }
+    dsu(ll n) : p(n, -1), comps(n) {}
 
+    ll find(ll a) {
+        while (p[a] >= 0 && p[p[a]] >= 0) a = p[a] = p[p[a]];
+        return p[a] < 0 ? a : p[a];
+    }
     bool uni(ll a, ll b) {
         a = find(a), b = find(b);
         if (a == b) return false;
-        if (len[a] < len[b]) swap(a, b);
-        len[a] += len[b], id[b] = a;
+        if (p[a] > p[b]) swap(a, b);
+        p[a] += p[b], p[b] = a, comps--;
+        touched.push_back(a), touched.push_back(b);
         return true;
     }
+    bool same(ll a, ll b) { return find(a) == find(b); }
+    ll size(ll a) { return -p[find(a)]; }
+    ll count_components() { return comps; }
+
+    void reset() {
+        for (int x : touched) p[x] = -1;
+        comps += sz(touched) / 2;
+        touched.clear();
+    }
 };
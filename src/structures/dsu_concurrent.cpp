@@ -0,0 +1,55 @@
+// Concurrent Disjoint Set Union (Lock-Free Union-Find)
+//
+// Parents are atomics; find does path halving with CAS and uni links the larger root
+// index under the smaller one with a single CAS on the root, retrying if it raced.
+// Safe to call find/same/uni from many threads at once. uni_batch splits the edges
+// among std::thread workers and returns how many unions succeeded.
+// For adversarial inputs, relabel vertices with a random permutation (randomized linking).
+//
+// complexity: O(log N) amortized per op, O(N)
+
+struct dsu_concurrent {
+    vector<atomic<uint32_t>> p;
+
+    dsu_concurrent(ll n) : p(n) { forn(i, 0, n) p[i].store(i, memory_order_relaxed); }
+
+    ll find(ll a) {
+        while (true) {
+            uint32_t b = p[a].load(), c = p[b].load();
+            if (b == c) return b;
+            p[a].compare_exchange_weak(b, c, memory_order_relaxed);
+            a = c;
+        }
+    }
+
+    bool same(ll a, ll b) {
+        while (true) {
+            a = find(a), b = find(b);
+            if (a == b) return true;
+            if (p[a].load() == a) return false; // a ainda e raiz, logo sao distintos
+        }
+    }
+
+    bool uni(ll a, ll b) {
+        while (true) {
+            a = find(a), b = find(b);
+            if (a == b) return false;
+            if (a < b) swap(a, b);
+            uint32_t e = a;
+            if (p[a].compare_exchange_strong(e, b)) return true;
+        }
+    }
+
+    ll uni_batch(vector<pll>& e, ll th = thread::hardware_concurrency()) {
+        th = max(th, 1ll);
+        vll cnt(th);
+        vector<thread> ts;
+        forn(k, 0, th) ts.emplace_back([&, k] {
+            ll c = 0;
+            for (ll i = k * sz(e) / th; i < (k+1) * sz(e) / th; i++) c += uni(e[i].first, e[i].second);
+            cnt[k] = c;
+        });
+        for (auto& t : ts) t.join();
+        return accumulate(cnt.begin(), cnt.end(), 0ll);
+    }
+};
@@ -1,39 +1,39 @@
 // DSU with Rollback (Persistent/Undoable Union-Find)
 //
-// Allows merging sets and undoing operations to a previous state
-// using a stack of modifications. No Path Compression to keep
-// tree structure reversible.
+// Allows merging sets and undoing operations to a previous state.
+// The undo log is a flat vector holding only the absorbed root of each union:
+// undoing it restores both id and len in O(1). No Path Compression to keep
+// tree structure reversible. comps tracks the number of components.
 //
 // complexity: O(log N) per find/unite, O(1) per checkpoint/rollback
 
 struct dsu_rb {
-    vll id, len;
-    ll allbip = true;
-    stack<pair<ll&, ll>> st;
+    vll id, len, st;
+    ll comps, allbip = true;
 
-    dsu_rb(ll n) : id(n), len(n, 1) { 
-        iota(id.begin(), id.end(), 0); 
+    dsu_rb(ll n) : id(n), len(n, 1), comps(n) {
+        iota(id.begin(), id.end(), 0);
     }
-    
-	void save(ll &x) {  st.emplace(x, x);}
-    
+
 	ll time() { return sz(st); }
     void rollback(ll t) {
-        while(sz(st) > t) {
-            auto [end, val] = st.top(); st.pop();
-            end = val;
+        while (sz(st) > t) {
+            ll b = st.back(); st.pop_back();
+            len[id[b]] -= len[b], id[b] = b, comps++;
         }
     }
-    
-	ll find(ll a) { return a == id[a] ? a : find(id[a]); }
-    
+
+	ll find(ll a) {
+        while (a != id[a]) a = id[a];
+        return a;
+    }
+
 	bool unite(ll a, ll b) {
         a = find(a), b = find(b);
-        if (a == b) return false;        
+        if (a == b) return false;
         if (len[a] < len[b]) swap(a, b);
-		save(len[a]);
-        save(id[b]);
-        len[a] += len[b], id[b] = a;
+        len[a] += len[b], id[b] = a, comps--;
+        st.push_back(b);
 		return true;
     }
 };
@@ -0,0 +1,46 @@
+// Weighted Disjoint Set Union (Potentials)
+//
+// dsu.cpp plus a potential per node: uni(a, b, d) imposes val[b] - val[a] = d
+// (returns false, ignoring d, if already joined) and diff(a, b) returns val[b] - val[a].
+// Same size, count_components and reset as dsu.
+//
+// complexity: O(alpha(N)) amortized per op, O(N)
+
+struct dsu_weighted {
+    vector<int> p, touched;
+    vll w; // w[a] = val[a] - val[pai de a]
+    ll comps;
+
+    dsu_weighted(ll n) : p(n, -1), w(n), comps(n) {}
+
+    ll find(ll a) {
+        while (p[a] >= 0 && p[p[a]] >= 0) w[a] += w[p[a]], a = p[a] = p[p[a]];
+        return p[a] < 0 ? a : p[a];
+    }
+    ll pot(ll a) { // val[a] - val[raiz]
+        ll ret = 0;
+        for (find(a); p[a] >= 0; a = p[a]) ret += w[a];
+        return ret;
+    }
+
+    bool uni(ll a, ll b, ll d = 0) {
+        ll ra = find(a), rb = find(b);
+        if (ra == rb) return false;
+        d += pot(a) - pot(b);
+        if (p[ra] > p[rb]) swap(ra, rb), d = -d;
+        p[ra] += p[rb], p[rb] = ra, w[rb] = d, comps--;
+        touched.push_back(ra), touched.push_back(rb);
+        return true;
+    }
+
+    bool same(ll a, ll b) { return find(a) == find(b); }
+    ll size(ll a) { return -p[find(a)]; }
+    ll count_components() { return comps; }
+    ll diff(ll a, ll b) { return pot(b) - pot(a); } // requer same(a, b)
+
+    void reset() {
+        for (int x : touched) p[x] = -1, w[x] = 0;
+        comps += sz(touched) / 2;
+        touched.clear();
+    }
+};
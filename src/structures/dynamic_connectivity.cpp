@@ -1,38 +1,70 @@
-// Segment Tree Over Time (Dynamic Connectivity Skeleton)
+// Offline Dynamic Connectivity (Segment Tree Over Time)
 //
-// Stores edge activation intervals in a segment tree over time to enable offline dynamic connectivity with rollback DSU.
+// Events are numbered in order: add(u, v), rem(u, v) (edge must be present; multi-edges ok),
+// connected(u, v) and comps(). Each edge lives on O(log T) nodes of a bottom-up segment
+// tree over time, stored flat (CSR); solve() walks that tree with an explicit stack,
+// uniting on entry and rolling the dsu_rb back on exit, and skips subtrees without queries.
+// Returns one answer per query, in order: 1/0 for connected, the count for comps.
+//
+// complexity: O(T log T log N), O(T log T)
 
-struct time_query{
-    ll l, r;
-    time_query(ll l_, ll r_){
-        l = l_;
-        r = r_;
-    }
-};
+#include "src/structures/dsu_rb.cpp"
 
-struct time_node {
-    ll lm, rm;
-    unique_ptr<time_node> lc, rc;
+struct dyn_con {
+    ll n;
+    vector<array<ll, 3>> ev; // {tipo, u, v}: 0 add, 1 rem, 2 connected, 3 comps
 
-    vector<time_query> op;
+    dyn_con(ll n_) : n(n_) {}
+    void add(ll u, ll v) { ev.push_back({0, min(u, v), max(u, v)}); }
+    void rem(ll u, ll v) { ev.push_back({1, min(u, v), max(u, v)}); }
+    void connected(ll u, ll v) { ev.push_back({2, u, v}); }
+    void comps() { ev.push_back({3, 0, 0}); }
 
-    time_node(ll lm_, ll rm_){
-        lm = lm_;
-        rm = rm_;
-        if (lm != rm) {
-            ll mid = (lm + rm) / 2;
-            lc = make_unique<time_node>(lm, mid);
-            rc = make_unique<time_node>(mid + 1, rm);
+    vll solve() {
+        ll T = sz(ev), s = 1;
+        while (s < T) s *= 2;
+        vector<pair<ll, pll>> items; // {no, aresta}
+        auto put = [&](ll l, ll r, pll e) {
+            for (l += s, r += s+1; l < r; l /= 2, r /= 2) {
+                if (l&1) items.push_back({l++, e});
+                if (r&1) items.push_back({--r, e});
+            }
+        };
+        map<pll, vll> open;
+        forn(t, 0, T) {
+            auto [k, u, v] = ev[t];
+            if (k == 0) open[{u, v}].push_back(t);
+            if (k == 1) {
+                auto& o = open[{u, v}];
+                put(o.back(), t-1, {u, v}), o.pop_back();
+            }
         }
-    }
+        for (auto& [e, o] : open) for (ll t : o) put(t, T-1, e);
+
+        vll start(2*s + 1, 0), has(2*s, 0);
+        vector<pll> edges(sz(items));
+        for (auto& it : items) start[it.first + 1]++;
+        forn(i, 0, 2*s) start[i+1] += start[i];
+        vll pos(start.begin(), start.end() - 1);
+        for (auto& [x, e] : items) edges[pos[x]++] = e;
+        forn(t, 0, T) has[t + s] = ev[t][0] >= 2;
+        for (ll x = s-1; x; x--) has[x] = has[2*x] | has[2*x+1];
 
-    void add_query(ll lq, ll rq, time_query x) {
-        if (rq < lm || lq > rm) return;
-        if (lq <= lm && rm <= rq) {
-            op.push_back(x);
-            return;
+        dsu_rb d(n);
+        vll ret, stk = {1}, saved(2*s);
+        while (!stk.empty()) {
+            ll x = stk.back(); stk.pop_back();
+            if (x < 0) { d.rollback(saved[~x]); continue; }
+            if (!has[x]) continue;
+            saved[x] = d.time();
+            forn(i, start[x], start[x+1]) d.unite(edges[i].first, edges[i].second);
+            if (x >= s) {
+                auto [k, u, v] = ev[x - s];
+                ret.push_back(k == 2 ? d.find(u) == d.find(v) : d.comps);
+            }
+            stk.push_back(~x);
+            if (x < s) stk.push_back(2*x+1), stk.push_back(2*x);
         }
-        lc->add_query(lq, rq, x);
-        rc->add_query(lq, rq, x);
+        return ret;
     }
 };
@@ -1,6 +1,8 @@
 // Fenwick Tree (Binary Indexed Tree)
 //
 // Supports point updates and prefix/range sum queries in logarithmic time using a 1-indexed BIT.
+// upper_bound prefetches both candidates of the next descent step, hiding the
+// cache misses of the large power-of-two strides once n no longer fits in L2.
 //
 // complexity: O(log N) per op, O(N)
 
@@ -28,9 +30,14 @@ struct Bit {
     }
     ll upper_bound(ll x) {
         ll p = 0;
-        for (ll i = __lg(n); i+1; i--) 
-            if (p + (1<<i) <= n && bit[p + (1<<i)] <= x)
-                x -= bit[p += (1 << i)];
+        for (ll i = __lg(n); i+1; i--) {
+            if (i) {
+                __builtin_prefetch(bit.data() + min(n, p + (1ll << (i-1))));
+                __builtin_prefetch(bit.data() + min(n, p + (3ll << (i-1))));
+            }
+            if (p + (1ll<<i) <= n && bit[p + (1ll<<i)] <= x)
+                x -= bit[p += (1ll << i)];
+        }
         return p;
     }
 };
@@ -0,0 +1,95 @@
+// Flat Hash Map (Open Addressing, SSE2 Group Probing)
+//
+// Keys and values live in one flat array; a parallel array of control bytes holds
+// a 7-bit tag per slot (or EMPTY), and lookups compare 16 tags at once with SSE2.
+// Linear probing from the home slot, so erase does backward shift: no tombstones.
+// Capacity is a power of two, grown at 7/8 load; clear() costs O(slots touched).
+// Works with any key that chash_seq hashes (ll, pll, tuple, vll, string).
+//
+// complexity: O(1) expected per op, O(capacity)
+
+#include <immintrin.h>
+#include "src/structures/hashmap_seq.cpp"
+
+template<typename K, typename V, typename H = chash_seq> struct flat_hash_map {
+    static constexpr int8_t EMPTY = -128;
+    ll cap = 0, cnt = 0;
+    vector<int8_t> ctrl; // cap + 16: os 16 primeiros sao espelhados no fim
+    vector<pair<K, V>> slot;
+    vll touched;
+    H hs;
+
+    flat_hash_map(ll n = 0) { reserve(n); }
+
+    uint64_t hash(const K& k) const { return hs(k); }
+    ll home(uint64_t h) const { return (h >> 7) & (cap - 1); }
+    void set_ctrl(ll i, int8_t c) {
+        ctrl[i] = c;
+        if (i < 16) ctrl[cap + i] = c;
+        if (c != EMPTY && sz(touched) < cap) touched.push_back(i);
+    }
+    uint32_t match(ll i, int8_t c) const {
+        __m128i g = _mm_loadu_si128((const __m128i*)&ctrl[i]);
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(g, _mm_set1_epi8(c)));
+    }
+
+    // slot de k, ou ~(primeiro vazio a partir de home), onde k seria inserido
+    ll probe(const K& k, uint64_t h) const {
+        int8_t tag = h & 127;
+        for (ll i = home(h); ; i = (i + 16) & (cap - 1)) {
+            for (uint32_t m = match(i, tag); m; m &= m - 1) {
+                ll j = (i + __builtin_ctz(m)) & (cap - 1);
+                if (slot[j].first == k) return j;
+            }
+            if (uint32_t e = match(i, EMPTY)) return ~((i + __builtin_ctz(e)) & (cap - 1));
+        }
+    }
+    ll find(const K& k) const { // indice do slot de k, ou -1
+        ll j = probe(k, hash(k));
+        return j >= 0 ? j : -1;
+    }
+    ll count(const K& k) const { return find(k) >= 0; }
+    ll size() const { return cnt; }
+
+    V& operator[](const K& k) {
+        uint64_t h = hash(k);
+        ll j = probe(k, h);
+        if (j >= 0) return slot[j].second;
+        if (8 * (cnt + 1) > 7 * cap) rehash(2 * cap), j = probe(k, h);
+        j = ~j;
+        slot[j] = {k, V()}, set_ctrl(j, h & 127), cnt++;
+        return slot[j].second;
+    }
+
+    bool erase(const K& k) {
+        ll i = find(k);
+        if (i < 0) return false;
+        for (ll j = (i + 1) & (cap - 1); ctrl[j] != EMPTY; j = (j + 1) & (cap - 1)) {
+            ll d = home(hash(slot[j].first));
+            if (((j - d) & (cap - 1)) >= ((j - i) & (cap - 1)))
+                slot[i] = slot[j], set_ctrl(i, ctrl[j]), i = j;
+        }
+        set_ctrl(i, EMPTY), cnt--;
+        return true;
+    }
+
+    void reserve(ll n) {
+        ll c = 16;
+        while (8 * n > 7 * c) c *= 2;
+        if (c > cap) rehash(c);
+    }
+    void rehash(ll c) {
+        vector<int8_t> oc(c + 16, EMPTY);
+        vector<pair<K, V>> os(c);
+        swap(oc, ctrl), swap(os, slot);
+        ll old = cap;
+        cap = c, cnt = 0;
+        touched.clear();
+        forn(i, 0, old) if (oc[i] != EMPTY) (*this)[os[i].first] = os[i].second;
+    }
+    void clear() {
+        if (sz(touched) >= cap) fill(ctrl.begin(), ctrl.end(), EMPTY);
+        else for (ll i : touched) set_ctrl(i, EMPTY);
+        touched.clear(), cnt = 0;
+    }
+};
@@ -1,23 +1,26 @@
 // Custom Hash for hash table
 //
-// Provides 64-bit hashers for integers and pairs to use with __gnu_pbds::gp_hash_table.
+// Provides 64-bit hashers for integers and pairs to use with __gnu_pbds::gp_hash_table
+// (or flat_hash_map). Anti-hack: splitmix64 keyed by a seed drawn at startup, so
+// collisions can't be precomputed. Tuples, vll and string: hashmap_seq.cpp.
 //
 // complexity: O(1) average, O(n)
 
 #include <bits/extc++.h> 
 
-// for ll
 struct chash {
-    const uint64_t C = ll(4e18 * acos(0)) | 71;
-    ll operator()(ll x) const { return __builtin_bswap64(x*C); }
-};
-
-// for pll
-struct chash {
-    size_t operator()(const pll& p) const {
-        return p.first ^ __builtin_bswap64(p.second);
+    static inline const uint64_t SEED = chrono::steady_clock::now().time_since_epoch().count();
+    static uint64_t mix(uint64_t x) { // splitmix64
+        x += 0x9e3779b97f4a7c15;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+        return x ^ (x >> 31);
     }
+    // for ll
+    size_t operator()(uint64_t x) const { return mix(x + SEED); }
+    // for pll
+    size_t operator()(const pll& p) const { return mix(mix(p.first + SEED) ^ p.second); }
 };
 
-__gnu_pbds::gp_hash_table<ll, ll, chash> h({},{},{},{},{1<<16});
-__gnu_pbds::gp_hash_table<pll, ll, chash> h({},{},{},{},{1<<16});
+// __gnu_pbds::gp_hash_table<ll, ll, chash> h({},{},{},{},{1<<16});
+// __gnu_pbds::gp_hash_table<pll, ll, chash> h({},{},{},{},{1<<16});
@@ -0,0 +1,38 @@
+// Custom Hash for tuples, vll and string
+//
+// chash_seq extends chash (hashmap.cpp) with tuple<...>, vll and string keys.
+// Long keys are consumed 8 bytes at a time into 4 independent lanes (no serial
+// dependency) and mixed at the end.
+//
+// complexity: O(len) per hash
+
+#include "src/structures/hashmap.cpp"
+
+struct chash_seq : chash {
+    using chash::operator();
+    static uint64_t words(const char* p, ll n) { // n bytes, 4 lanes de 8 bytes
+        uint64_t h[4] = {SEED, SEED ^ 1, SEED ^ 2, SEED ^ 3}, w;
+        ll i = 0;
+        for (; i + 32 <= n; i += 32) forn(k, 0, 4) {
+            memcpy(&w, p + i + 8*k, 8);
+            h[k] = rotl((h[k] ^ w) * 0x9e3779b97f4a7c15, 31);
+        }
+        for (ll k = 0; i < n; i += 8, k++) {
+            w = 0, memcpy(&w, p + i, min(8ll, n - i));
+            h[k] = rotl((h[k] ^ w) * 0x9e3779b97f4a7c15, 31);
+        }
+        return mix(mix(mix(mix(h[0] ^ n) ^ h[1]) ^ h[2]) ^ h[3]);
+    }
+
+    // for tuple<...>
+    template<class... T> size_t operator()(const tuple<T...>& t) const {
+        uint64_t h = SEED;
+        apply([&](const auto&... x) { ((h = mix(h ^ (*this)(x))), ...); }, t);
+        return h;
+    }
+    // for vll / string
+    size_t operator()(const vll& v) const { return words((const char*)v.data(), 8 * sz(v)); }
+    size_t operator()(const string& s) const { return words(s.data(), sz(s)); }
+};
+
+// __gnu_pbds::gp_hash_table<string, ll, chash_seq> h({},{},{},{},{1<<16});
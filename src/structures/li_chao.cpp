@@ -0,0 +1,61 @@
+// Li Chao Tree
+//
+// Maximo de retas em pontos x conhecidos offline (xs, comprimidos), em arvore de vetor
+// add(a, b) adiciona ax + b em todo x; add_segment(a, b, lo, hi) so para x em [lo, hi]
+// query(x) computa maximo de ax + b, com x em xs (-INF se nao ha reta)
+// Para evitar overflow use T = __int128
+//
+// O(log n) por add e query, O(log^2 n) por add_segment
+
+template<typename T = ll> struct lichao {
+    struct line {
+        T a, b;
+        T operator()(T x) const { return a * x + b; }
+    };
+    ll n;
+    vector<T> xs;
+    vector<line> t;
+
+    lichao(vector<T> xs_) : xs(xs_) {
+        sort(xs.begin(), xs.end());
+        xs.erase(unique(xs.begin(), xs.end()), xs.end());
+        n = sz(xs);
+        t.assign(4 * max(n, 1ll), {0, -INF});
+    }
+
+    void add(line f, ll p, ll l, ll r) {
+        while (true) {
+            ll m = (l+r)/2;
+            bool lef = f(xs[l]) > t[p](xs[l]), mid = f(xs[m]) > t[p](xs[m]);
+            if (mid) swap(t[p], f);
+            if (l == r) return;
+            if (lef != mid) p = 2*p, r = m;
+            else p = 2*p+1, l = m+1;
+        }
+    }
+    void add(T a, T b) { if (n) add({a, b}, 1, 0, n-1); }
+
+    void add_segment(line f, ll p, ll l, ll r, ll a, ll b) {
+        if (b < l || r < a) return;
+        if (a <= l && r <= b) return add(f, p, l, r);
+        ll m = (l+r)/2;
+        add_segment(f, 2*p, l, m, a, b), add_segment(f, 2*p+1, m+1, r, a, b);
+    }
+    void add_segment(T a, T b, T lo, T hi) {
+        ll l = lower_bound(xs.begin(), xs.end(), lo) - xs.begin();
+        ll r = upper_bound(xs.begin(), xs.end(), hi) - xs.begin() - 1;
+        if (l <= r) add_segment({a, b}, 1, 0, n-1, l, r);
+    }
+
+    T query(T x) {
+        ll i = lower_bound(xs.begin(), xs.end(), x) - xs.begin();
+        T ret = -INF;
+        for (ll p = 1, l = 0, r = n-1; ; ) {
+            ret = max(ret, t[p](x));
+            if (l == r) return ret;
+            ll m = (l+r)/2;
+            if (i <= m) p = 2*p, r = m;
+            else p = 2*p+1, l = m+1;
+        }
+    }
+};
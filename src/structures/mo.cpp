@@ -1,62 +1,63 @@
 // Mo's Algorithm (Offline Range Queries)
 //
 // Answers offline range queries by ordering them (block or Hilbert curve) to get small pointer movement and amortized updates.
+// The state S provides add_left(i), add_right(i), remove_left(i), remove_right(i)
+// and answer(); queries are inclusive [l, r]. The order is chosen at runtime
+// (hil = true: Hilbert, false: odd-even blocks) and sized from the queries, so
+// several instances can live in the same binary. Parallel mode: mo_parallel.cpp.
 //
 // complexity: O((N + Q) sqrt N), O(N)
 
-const ll MAX = 2e5+10;
-const ll SQ = sqrt(MAX);
-ll ans;
-
-inline void insert(ll p) {
-}
-
-inline void erase(ll p) {
-}
-
-inline ll hilbert(ll x, ll y) {
-    static ll N = 1 << (__builtin_clzll(0ll) - __builtin_clzll(MAX));
-    ll rx, ry, s;
+ll hilbert(ll x, ll y, ll lg) {
     ll d = 0;
-    for (s = N/2; s > 0; s /= 2) {
-        rx = (x & s) > 0, ry = (y & s) > 0;
-        d += s * ll(s) * ((3 * rx) ^ ry);
+    for (ll s = 1ll << (lg - 1); s; s /= 2) {
+        ll rx = (x & s) > 0, ry = (y & s) > 0;
+        d += s * s * ((3 * rx) ^ ry);
         if (ry == 0) {
-            if (rx == 1) x = N-1 - x, y = N-1 - y;
+            if (rx == 1) x = s-1 - x, y = s-1 - y;
             swap(x, y);
         }
     }
     return d;
 }
 
-#define HILBERT true
-vll MO(vector<pair<ll, ll>> &q) {
-    ans = 0;
-    ll m = sz(q);
-    vll ord(m);
+vll mo_order(vector<pll>& q, bool hil = true) {
+    ll m = sz(q), n = 1;
+    for (auto [l, r] : q) n = max(n, r + 1);
+    vll ord(m), h(m);
     iota(ord.begin(), ord.end(), 0);
-#if HILBERT
-    vll h(m);
-    for (ll i = 0; i < m; i++) h[i] = hilbert(q[i].first, q[i].second);
-    sort(ord.begin(), ord.end(), [&](ll l, ll r) { return h[l] < h[r]; });
-#else
-    sort(ord.begin(), ord.end(), [&](ll l, ll r) {
-        if (q[l].first / SQ != q[r].first / SQ) return q[l].first < q[r].first;
-        if ((q[l].first / SQ) % 2) return q[l].second > q[r].second;
-        return q[l].second < q[r].second;
-    });
-#endif
-    vll ret(m);
-    ll l = 0, r = -1;
+    if (hil) {
+        ll lg = 64 - __builtin_clzll(n);
+        forn(i, 0, m) h[i] = hilbert(q[i].first, q[i].second, lg);
+    } else {
+        ll b = max(1ll, (ll)(n / sqrt(max(m, 1ll))));
+        forn(i, 0, m) {
+            ll blk = q[i].first / b;
+            h[i] = blk * (n + 1) + (blk % 2 ? n - q[i].second : q[i].second);
+        }
+    }
+    sort(ord.begin(), ord.end(), [&](ll a, ll b) { return h[a] < h[b]; });
+    return ord;
+}
 
-    for (ll i : ord) {
-        ll ql, qr;
-        tie(ql, qr) = q[i];
-        while (r < qr) insert(++r);
-        while (l > ql) insert(--l);
-        while (l < ql) erase(l++);
-        while (r > qr) erase(r--);
-        ret[i] = ans;
+// janela vazia comeca em l = primeiro ql, entao a primeira query custa qr - ql + 1
+template<class S, class R> void mo_run(S& s, vector<pll>& q, vll& ord, ll lo, ll hi, R& ret) {
+    if (lo >= hi) return;
+    ll l = q[ord[lo]].first, r = l - 1;
+    forn(k, lo, hi) {
+        ll i = ord[k];
+        auto [ql, qr] = q[i];
+        while (r < qr) s.add_right(++r);
+        while (l > ql) s.add_left(--l);
+        while (l < ql) s.remove_left(l++);
+        while (r > qr) s.remove_right(r--);
+        ret[i] = s.answer();
     }
+}
+
+template<class S> auto MO(S& s, vector<pll>& q, bool hil = true) {
+    vector<decltype(s.answer())> ret(sz(q));
+    vll ord = mo_order(q, hil);
+    mo_run(s, q, ord, 0, sz(q), ret);
     return ret;
 }
@@ -0,0 +1,36 @@
+// Mo's Algorithm (Parallel)
+//
+// MO_parallel(s, q, th, hil) answers the same queries as MO from mo.cpp on th threads.
+// S must be copyable and its copies independent; answer() returning bool is
+// stored as char.
+//
+// complexity: O((N + Q) sqrt N) work split over th threads, O(th * |S| + Q)
+
+#include "src/structures/mo.cpp"
+
+// Cuts the order into th chunks of about the same pointer movement (a chunk
+// starts from an empty window at its first query, costing r - l + 1) and runs
+// each on its own thread with a copy of s.
+template<class S> auto MO_parallel(const S& s, vector<pll>& q, ll th = thread::hardware_concurrency(), bool hil = true) {
+    ll m = sz(q);
+    th = max(1ll, min(th, m));
+    using R = decltype(S(s).answer());
+    vector<conditional_t<is_same_v<R, bool>, char, R>> ret(m); // vector<bool> nao e thread-safe
+    vll ord = mo_order(q, hil), pre(m + 1);
+    forn(k, 0, m) {
+        auto [l, r] = q[ord[k]];
+        ll c = r - l + 1;
+        if (k) c = min(c, abs(l - q[ord[k-1]].first) + abs(r - q[ord[k-1]].second));
+        pre[k+1] = pre[k] + c;
+    }
+    vll cut(th + 1, m);
+    cut[0] = 0;
+    forn(j, 1, th) cut[j] = lower_bound(pre.begin(), pre.end(), (__int128)pre[m] * j / th) - pre.begin();
+    vector<thread> ts;
+    forn(j, 0, th) ts.emplace_back([&, j] {
+        S cur = s;
+        mo_run(cur, q, ord, cut[j], cut[j+1], ret);
+    });
+    for (auto& t : ts) t.join();
+    return ret;
+}
@@ -0,0 +1,53 @@
+// Mo's Algorithm on Trees
+//
+// Offline path queries (u, v) on vertex values. The Euler tour (entry and exit
+// of each vertex) turns a path into a range where vertices seen twice cancel
+// out; the LCA is added separately when it is not an endpoint. S provides
+// add(v), remove(v) and answer(); the order of add/remove is arbitrary.
+//
+// complexity: O((N + Q) sqrt N), O(N)
+
+#include "src/structures/mo.cpp"
+#include "src/graphs/lca.cpp"
+
+template<class S> auto MO_tree(S& s, vector<vll>& g, vector<pll>& q, ll root = 0, bool hil = true) {
+    ll n = sz(g), m = sz(q), T = 0;
+    vll st(n), en(n), who(2 * n), it(n), par(n, -1), stk = {root};
+    st[root] = T, who[T++] = root;
+    while (sz(stk)) {
+        ll v = stk.back();
+        if (it[v] == sz(g[v])) { en[v] = T, who[T++] = v, stk.pop_back(); continue; }
+        ll y = g[v][it[v]++];
+        if (y == par[v]) continue;
+        par[y] = v, st[y] = T, who[T++] = y, stk.push_back(y);
+    }
+    LCA lc(g, root);
+    vector<pll> rg(m);
+    vll extra(m, -1);
+    forn(i, 0, m) {
+        auto [u, v] = q[i];
+        if (st[u] > st[v]) swap(u, v);
+        ll w = lc.lca(u, v);
+        if (w == u) rg[i] = {st[u], st[v]};
+        else rg[i] = {en[u], st[v]}, extra[i] = w;
+    }
+    vector<char> in(n);
+    auto flip = [&](ll p) {
+        ll v = who[p];
+        if ((in[v] ^= 1)) s.add(v);
+        else s.remove(v);
+    };
+    vector<decltype(s.answer())> ret(m);
+    ll l = 0, r = -1;
+    for (ll i : mo_order(rg, hil)) {
+        auto [ql, qr] = rg[i];
+        while (r < qr) flip(++r);
+        while (l > ql) flip(--l);
+        while (l < ql) flip(l++);
+        while (r > qr) flip(r--);
+        if (extra[i] != -1) s.add(extra[i]);
+        ret[i] = s.answer();
+        if (extra[i] != -1) s.remove(extra[i]);
+    }
+    return ret;
+}
@@ -0,0 +1,36 @@
+// Mo's Algorithm with Updates
+//
+// Offline range queries interleaved with point updates. Query {l, r, t} is
+// answered after the first t updates. S extends the Mo state with
+// apply(j, l, r): toggles update j while the window is [l, r] (the usual trick
+// is to swap the stored value with a[pos], so a second call undoes it).
+// Blocks of size N^(2/3) over (l, r), then t.
+//
+// complexity: O(N^(5/3)) for N ~ Q ~ updates, O(N)
+
+#include "src/structures/mo.cpp"
+
+template<class S> auto MO_update(S& s, vector<array<ll, 3>>& q, ll n) {
+    ll m = sz(q), b = max(1ll, (ll)cbrt((double)n * n));
+    vll ord(m);
+    iota(ord.begin(), ord.end(), 0);
+    sort(ord.begin(), ord.end(), [&](ll x, ll y) {
+        auto& a = q[x]; auto& c = q[y];
+        if (a[0] / b != c[0] / b) return a[0] < c[0];
+        if (a[1] / b != c[1] / b) return (a[0] / b) % 2 ? a[1] > c[1] : a[1] < c[1];
+        return (a[1] / b) % 2 ? a[2] > c[2] : a[2] < c[2];
+    });
+    vector<decltype(s.answer())> ret(m);
+    ll l = 0, r = -1, t = 0;
+    for (ll i : ord) {
+        auto [ql, qr, qt] = q[i];
+        while (r < qr) s.add_right(++r);
+        while (l > ql) s.add_left(--l);
+        while (l < ql) s.remove_left(l++);
+        while (r > qr) s.remove_right(r--);
+        while (t < qt) s.apply(t++, l, r);
+        while (t > qt) s.apply(--t, l, r);
+        ret[i] = s.answer();
+    }
+    return ret;
+}
@@ -1,51 +1,55 @@
 // Persistent Segment Tree - O(log n) per query/update
 // Supports point updates and range queries across versions
+//
+// Op::comb(a, b) combines two ranges. Nodes use 32-bit child indices (16 bytes
+// for ll) and live in a chunked arena, so versions can be appended without
+// knowing q in advance. Range add and kth: perseg_lazy.cpp (same interface).
 
-struct Node {
-	ll val;
-	ll l, r;
+struct sum_op {
+	static ll comb(ll a, ll b) { return a + b; }
 };
 
-struct perseg {
-	ll n, cnt = 0;
-	vector<Node> nd;
-	vll rt;
+template<typename T = ll, typename Op = sum_op> struct perseg {
+	struct Node { T val; uint32_t l, r; };
+	static const ll K = 16; // 2^K nodes por chunk
 
-	perseg(vll& v, ll q = 0) : n(sz(v)) {
-		nd.reserve(2*n + 18*(n+q));
-		rt.reserve(q + 2);
-		rt.push_back(cnt++);
-		build(nd.data(), cnt, rt[0], 0, n-1, v);
+	ll n;
+	uint32_t cnt = 0;
+	vector<unique_ptr<Node[]>> chunks;
+	vector<uint32_t> rt;
+
+	Node& at(uint32_t p) { return chunks[p >> K][p & ((1 << K) - 1)]; }
+	uint32_t alloc(const Node& x) {
+		if (!(cnt & ((1 << K) - 1))) chunks.emplace_back(new Node[1 << K]);
+		at(cnt) = x;
+		return cnt++;
 	}
-	static ll build(Node* d, ll& cnt, ll p, ll l, ll r, vll& v) {
-		if (l == r) return d[p].val = v[l];
-		d[p].l = cnt++; d[p].r = cnt++;
+
+	perseg(vector<T>& v) : n(sz(v)) { rt.push_back(build(0, n-1, v)); }
+	uint32_t build(ll l, ll r, vector<T>& v) {
+		if (l == r) return alloc({v[l], 0, 0});
 		ll m = (l+r)/2;
-		return d[p].val = build(d, cnt, d[p].l, l, m, v) + build(d, cnt, d[p].r, m+1, r, v);
+		uint32_t a = build(l, m, v), b = build(m+1, r, v);
+		return alloc({Op::comb(at(a).val, at(b).val), a, b});
 	}
-	ll query(ll a, ll b, ll t) {
-		return query(nd.data(), a, b, rt[t], 0, n-1);
-	}
-	static ll query(Node* d, ll a, ll b, ll p, ll l, ll r) {
-		if (b < l || r < a) return 0;
-		if (a <= l && r <= b) return d[p].val;
+
+	T query(ll a, ll b, ll t) { return query(rt[t], 0, n-1, a, b); }
+	T query(uint32_t p, ll l, ll r, ll a, ll b) { // requires [a, b] inside [l, r]
+		if (a == l && r == b) return at(p).val;
 		ll m = (l+r)/2;
-		return query(d, a, b, d[p].l, l, m) + query(d, a, b, d[p].r, m+1, r);
+		if (b <= m) return query(at(p).l, l, m, a, b);
+		if (a > m) return query(at(p).r, m+1, r, a, b);
+		return Op::comb(query(at(p).l, l, m, a, m), query(at(p).r, m+1, r, m+1, b));
 	}
-	ll set(ll a, ll val, ll t) {
-		ll nr = cnt++;
-		set(nd.data(), cnt, a, val, rt[t], nr, 0, n-1);
-		rt.push_back(nr);
-		return (ll)rt.size()-1;
-	}
-	static ll set(Node* d, ll& cnt, ll a, ll val, ll lp, ll p, ll l, ll r) {
-		if (l == r) return d[p].val = val;
+
+	ll set(ll a, T val, ll t) { rt.push_back(set(rt[t], 0, n-1, a, val)); return sz(rt)-1; }
+	uint32_t set(uint32_t lp, ll l, ll r, ll a, T val) {
+		uint32_t p = alloc(at(lp));
+		if (l == r) { at(p).val = val; return p; }
 		ll m = (l+r)/2;
-		if (a <= m) {
-			d[p].l = cnt++; d[p].r = d[lp].r;
-			return d[p].val = set(d, cnt, a, val, d[lp].l, d[p].l, l, m) + d[d[p].r].val;
-		}
-		d[p].l = d[lp].l; d[p].r = cnt++;
-		return d[p].val = d[d[p].l].val + set(d, cnt, a, val, d[lp].r, d[p].r, m+1, r);
+		if (a <= m) { uint32_t c = set(at(lp).l, l, m, a, val); at(p).l = c; }
+		else { uint32_t c = set(at(lp).r, m+1, r, a, val); at(p).r = c; }
+		at(p).val = Op::comb(at(at(p).l).val, at(at(p).r).val);
+		return p;
 	}
-};
\ No newline at end of file
+};
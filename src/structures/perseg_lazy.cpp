@@ -0,0 +1,151 @@
+// Persistent Segment Tree (range add, kth) - O(log n) per query/update
+// Supports point updates, range queries and (if LAZY) range add across versions
+// Superset of perseg.cpp with the same interface (use one or the other)
+//
+// Op::comb(a, b) combines two ranges; Op::apply(v, x, len) adds x to each of len
+// elements summarized by v. Range add is persistent without propagation: the tag
+// stays on the copied node and queries apply it on the way back up.
+// set(a, val, t) assumes apply(v, x, 1) == v + x (true for sum, min and max).
+// Nodes use 32-bit child indices (16 bytes for ll without LAZY) and live in a
+// chunked arena, so versions can be appended without knowing q in advance.
+//
+// Order statistics (T = ll counts, no LAZY): with version i holding the counts of the
+// (compressed) values of a[0..i), a[l..r] is described by versions (l, r+1).
+// kth and count_less descend both roots in one pass; kth_batch answers many kth
+// queries, sharing the descent among queries on the same pair of versions.
+
+struct sum_op {
+	static ll comb(ll a, ll b) { return a + b; }
+	static ll apply(ll v, ll x, ll len) { return v + x * len; }
+};
+// max: comb = max(a, b), apply = v + x
+
+template<typename T = ll, typename Op = sum_op, bool LAZY = false> struct perseg {
+	struct empty {};
+	struct Node {
+		T val;
+		uint32_t l, r;
+		[[no_unique_address]] conditional_t<LAZY, T, empty> lz;
+	};
+	static const ll K = 16; // 2^K nodes por chunk
+
+	ll n;
+	uint32_t cnt = 0;
+	vector<unique_ptr<Node[]>> chunks;
+	vector<uint32_t> rt;
+
+	Node& at(uint32_t p) { return chunks[p >> K][p & ((1 << K) - 1)]; }
+	uint32_t alloc(const Node& x) {
+		if (!(cnt & ((1 << K) - 1))) chunks.emplace_back(new Node[1 << K]);
+		at(cnt) = x;
+		return cnt++;
+	}
+
+	perseg(vector<T>& v) : n(sz(v)) { rt.push_back(build(0, n-1, v)); }
+	uint32_t build(ll l, ll r, vector<T>& v) {
+		if (l == r) return alloc({v[l], 0, 0, {}});
+		ll m = (l+r)/2;
+		uint32_t a = build(l, m, v), b = build(m+1, r, v);
+		return alloc({Op::comb(at(a).val, at(b).val), a, b, {}});
+	}
+
+	T query(ll a, ll b, ll t) { return query(rt[t], 0, n-1, a, b); }
+	T query(uint32_t p, ll l, ll r, ll a, ll b) { // requires [a, b] inside [l, r]
+		if (a == l && r == b) return at(p).val;
+		ll m = (l+r)/2;
+		T ret = b <= m ? query(at(p).l, l, m, a, b)
+			: a > m ? query(at(p).r, m+1, r, a, b)
+			: Op::comb(query(at(p).l, l, m, a, m), query(at(p).r, m+1, r, m+1, b));
+		if constexpr (LAZY) ret = Op::apply(ret, at(p).lz, b-a+1);
+		return ret;
+	}
+
+	ll new_version(uint32_t p) {
+		rt.push_back(p);
+		return sz(rt)-1;
+	}
+	void pull(uint32_t p, ll len) {
+		Node& x = at(p);
+		x.val = Op::comb(at(x.l).val, at(x.r).val);
+		if constexpr (LAZY) x.val = Op::apply(x.val, x.lz, len);
+	}
+
+	ll set(ll a, T val, ll t) { return new_version(set(rt[t], 0, n-1, a, val)); }
+	uint32_t set(uint32_t lp, ll l, ll r, ll a, T val) {
+		uint32_t p = alloc(at(lp));
+		if (l == r) {
+			at(p).val = val;
+			if constexpr (LAZY) at(p).lz = T();
+			return p;
+		}
+		if constexpr (LAZY) val = val - at(lp).lz; // tags of strict ancestors reach the leaf
+		ll m = (l+r)/2;
+		if (a <= m) { uint32_t c = set(at(lp).l, l, m, a, val); at(p).l = c; }
+		else { uint32_t c = set(at(lp).r, m+1, r, a, val); at(p).r = c; }
+		pull(p, r-l+1);
+		return p;
+	}
+
+	ll update(ll a, ll b, T x, ll t) { // soma x em [a, b]
+		static_assert(LAZY);
+		return new_version(update(rt[t], 0, n-1, a, b, x));
+	}
+	uint32_t update(uint32_t lp, ll l, ll r, ll a, ll b, T x) {
+		if (b < l || r < a) return lp;
+		uint32_t p = alloc(at(lp));
+		if (a <= l && r <= b) {
+			if constexpr (LAZY) at(p).lz = at(p).lz + x, at(p).val = Op::apply(at(p).val, x, r-l+1);
+			return p;
+		}
+		ll m = (l+r)/2;
+		uint32_t cl = update(at(lp).l, l, m, a, b, x), cr = update(at(lp).r, m+1, r, a, b, x);
+		at(p).l = cl, at(p).r = cr;
+		pull(p, r-l+1);
+		return p;
+	}
+
+	ll kth(ll lv, ll rv, ll k) { // k-esimo menor (0-based) de versao rv - versao lv
+		uint32_t a = rt[lv], b = rt[rv];
+		ll l = 0, r = n-1;
+		while (l < r) {
+			ll m = (l+r)/2, c = at(at(b).l).val - at(at(a).l).val;
+			if (k < c) a = at(a).l, b = at(b).l, r = m;
+			else k -= c, a = at(a).r, b = at(b).r, l = m+1;
+		}
+		return l;
+	}
+	ll count_less(ll lv, ll rv, ll x) { // quantidade de valores < x
+		uint32_t a = rt[lv], b = rt[rv];
+		ll l = 0, r = n-1, ret = 0;
+		while (x > l && x <= r) {
+			ll m = (l+r)/2;
+			if (x <= m) a = at(a).l, b = at(b).l, r = m;
+			else ret += at(at(b).l).val - at(at(a).l).val, a = at(a).r, b = at(b).r, l = m+1;
+		}
+		if (x > r) ret += at(b).val - at(a).val;
+		return ret;
+	}
+	vll kth_batch(vector<array<ll, 3>>& qs) { // {lv, rv, k}
+		vll ord(sz(qs)), k(sz(qs)), ret(sz(qs));
+		iota(ord.begin(), ord.end(), 0);
+		sort(ord.begin(), ord.end(), [&](ll i, ll j) { return qs[i] < qs[j]; });
+		forn(i, 0, sz(qs)) k[i] = qs[i][2];
+		for (ll i = 0, j; i < sz(ord); i = j) {
+			for (j = i; j < sz(ord) && qs[ord[j]][0] == qs[ord[i]][0]
+				&& qs[ord[j]][1] == qs[ord[i]][1]; j++);
+			kth_batch(rt[qs[ord[i]][0]], rt[qs[ord[i]][1]], 0, n-1,
+				ord.data()+i, ord.data()+j, k, ret);
+		}
+		return ret;
+	}
+	void kth_batch(uint32_t a, uint32_t b, ll l, ll r, ll* q, ll* e, vll& k, vll& ret) {
+		if (q == e) return;
+		if (l == r) { for (; q != e; q++) ret[*q] = l; return; }
+		ll m = (l+r)/2, c = at(at(b).l).val - at(at(a).l).val;
+		ll* s = partition_point(q, e, [&](ll i) { return k[i] < c; });
+		for (ll* i = s; i != e; i++) k[*i] -= c;
+		kth_batch(at(a).l, at(b).l, l, m, q, s, k, ret);
+		kth_batch(at(a).r, at(b).r, m+1, r, s, e, k, ret);
+	}
+};
+
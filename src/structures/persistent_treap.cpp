@@ -0,0 +1,106 @@
+// Persistent Implicit Treap (Rope)
+//
+// Same split/merge API as treap.cpp, but every operation copies the nodes on its path
+// into a bump arena, so all older versions stay valid. Merge picks the root at random
+// weighted by subtree sizes, which keeps shared subtrees (e.g. concat(v, v)) balanced.
+// drop(v) forgets a version; compact() keeps only nodes reachable from live versions
+// and renumbers them, so memory stays bounded under long edit sequences.
+//
+// complexity: O(log N) expected per op with O(log N) new nodes, O(total nodes) compact
+
+struct persistent_treap {
+    struct node {
+        ll val, sum;
+        uint32_t size, l, r;
+    };
+    vector<node> t;
+    vector<uint32_t> roots; // roots[v]: raiz da versao v, 0 = vazia ou descartada
+    uint64_t seed = 88172645463325252ull;
+
+    persistent_treap(vll v = {}) : t(1) {
+        uint32_t r = 0;
+        for (ll x : v) r = merge(r, new_node(x));
+        roots.push_back(r);
+    }
+
+    uint32_t xrand() { return seed ^= seed << 7, seed ^= seed >> 9; }
+    uint32_t new_node(ll v) {
+        t.push_back({v, v, 1, 0, 0});
+        return sz(t) - 1;
+    }
+    uint32_t copy(uint32_t x) {
+        t.push_back(t[x]);
+        return sz(t) - 1;
+    }
+    void pull(uint32_t x) {
+        node &a = t[t[x].l], &b = t[t[x].r];
+        t[x].size = 1 + a.size + b.size;
+        t[x].sum = t[x].val + a.sum + b.sum;
+    }
+
+    // first k elements of x go to a, the rest to b; x is left untouched
+    void split(uint32_t x, ll k, uint32_t &a, uint32_t &b) {
+        if (!x) { a = b = 0; return; }
+        uint32_t y = copy(x), c;
+        if (t[t[y].l].size < k) split(t[y].r, k - t[t[y].l].size - 1, c, b), t[y].r = c, a = y;
+        else split(t[y].l, k, a, c), t[y].l = c, b = y;
+        pull(y);
+    }
+    uint32_t merge(uint32_t a, uint32_t b) {
+        if (!a || !b) return a ^ b;
+        uint32_t y, c;
+        if (xrand() % (t[a].size + t[b].size) < t[a].size)
+            y = copy(a), c = merge(t[y].r, b), t[y].r = c;
+        else
+            y = copy(b), c = merge(a, t[y].l), t[y].l = c;
+        pull(y);
+        return y;
+    }
+
+    ll size(ll v) { return t[roots[v]].size; }
+    ll add_version(uint32_t r) {
+        roots.push_back(r);
+        return sz(roots) - 1;
+    }
+    ll insert(ll v, ll pos, ll x) { // retorna a nova versao
+        uint32_t a, b;
+        split(roots[v], pos, a, b);
+        return add_version(merge(merge(a, new_node(x)), b));
+    }
+    ll erase(ll v, ll pos) {
+        uint32_t a, b, c;
+        split(roots[v], pos, a, b), split(b, 1, b, c);
+        return add_version(merge(a, c));
+    }
+    ll concat(ll v1, ll v2) { return add_version(merge(roots[v1], roots[v2])); }
+    ll query(ll v, ll l, ll r) { // soma de [l, r], sem copiar nos
+        return pref(roots[v], r + 1) - pref(roots[v], l);
+    }
+    ll pref(uint32_t x, ll k) {
+        ll ret = 0;
+        while (x && k) {
+            ll ls = t[t[x].l].size;
+            if (k <= ls) x = t[x].l;
+            else ret += t[t[x].l].sum + t[x].val, k -= ls + 1, x = t[x].r;
+        }
+        return ret;
+    }
+
+    void drop(ll v) { roots[v] = 0; }
+    void compact() {
+        vector<uint32_t> id(sz(t), 0), st;
+        vector<node> nt(1);
+        auto visit = [&](uint32_t x) {
+            if (!x || id[x]) return;
+            id[x] = sz(nt), nt.push_back(t[x]), st.push_back(x);
+        };
+        for (uint32_t r : roots) visit(r);
+        while (!st.empty()) {
+            uint32_t x = st.back(); st.pop_back();
+            visit(t[x].l), visit(t[x].r);
+        }
+        for (node& x : nt) x.l = id[x.l], x.r = id[x.r];
+        for (uint32_t& r : roots) r = id[r];
+        t.swap(nt);
+    }
+};
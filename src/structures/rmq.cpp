@@ -0,0 +1,45 @@
+// Linear RMQ (Block Decomposition + In-Word Masks)
+//
+// Drop-in for sparse (same query(a, b) on a static array) using O(N) memory.
+// Blocks of 64: mask[i] keeps, as bits, the min-stack of the window ending at i,
+// so a query inside a block is one __builtin_clzll; a sparse table over block
+// minima (N/64 log N entries) covers the full blocks in between.
+//
+// complexity: O(N) build, O(1) query; O(N) space
+
+template<typename T> struct rmq {
+    static const ll b = 64;
+    ll n;
+    vector<T> v;
+    vector<uint64_t> mask;
+    vll t;
+
+    ll op(ll x, ll y) { return v[x] <= v[y] ? x : y; }
+    static ll msb(uint64_t x) { return 63 - __builtin_clzll(x); }
+    ll small(ll r, ll len = b) { // indice do minimo em [r-len+1, r], len <= b
+        return r - msb(len == b ? mask[r] : mask[r] & ((1ull << len) - 1));
+    }
+
+    rmq(const vector<T>& v_) : n(sz(v_)), v(v_), mask(n), t(n) {
+        uint64_t at = 0;
+        forn(i, 0, n) {
+            at <<= 1;
+            while (at && op(i - msb(at & -at), i) == i) at ^= at & -at;
+            mask[i] = at |= 1;
+        }
+        ll m = n / b;
+        forn(i, 0, m) t[i] = small(b*i + b-1);
+        for (ll j = 1; (1 << j) <= m; j++) for (ll i = 0; i + (1 << j) <= m; i++)
+            t[m*j + i] = op(t[m*(j-1) + i], t[m*(j-1) + i + (1 << (j-1))]);
+    }
+
+    ll index_query(ll l, ll r) {
+        if (r - l + 1 <= b) return small(r, r - l + 1);
+        ll ret = op(small(l + b-1), small(r));
+        ll x = l / b + 1, y = r / b - 1, m = n / b;
+        if (x > y) return ret;
+        ll j = msb(y - x + 1);
+        return op(ret, op(t[m*j + x], t[m*j + y - (1 << j) + 1]));
+    }
+    T query(ll l, ll r) { return v[index_query(l, r)]; }
+};
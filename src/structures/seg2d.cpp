@@ -1,56 +1,73 @@
 // SegTree 2D Iterativa
 //
 // Consultas 0-based
-// Um valor inicial em (x, y) deve ser colocado em seg[x+n][y+n]
-// Query: soma do retangulo ((x1, y1), (x2, y2))
+// init[x][y] e o valor inicial de (x, y)
+// Query: op do retangulo ((x1, y1), (x2, y2)), neutral e o elemento neutro de op
 // Update: muda o valor da posicao (x, y) para val
 // Nao pergunte como que essa coisa funciona
 //
+// Guarda tudo em um buffer so, linha x em seg[x*W, x*W + 2n), com W multiplo
+// de 8 (padding no fim de cada linha). Soma por padrao. Op precisa ser associativa
+// E comutativa: o build e a query combinam as celulas fora de ordem. Ex.:
+//   auto mn = [](ll a, ll b) { return min(a, b); };
+//   seg2d<ll, decltype(mn)> s(n, init, INF);
+//
 // Para query com distancia de manhattan <= d, faca
 // nx = x+y, ny = x-y
 // Update em (nx, ny), query em ((nx-d, ny-d), (nx+d, ny+d))
 //
-// Se for de min/max, pode tirar os if's da 'query', e fazer
-// sempre as 4 operacoes. Fica mais rapido
-//
 // Complexidades:
 // build - O(n^2)
 // query - O(log^2(n))
 // update - O(log^2(n))
 
+template<typename T> struct plus_op {
+	T operator()(const T& a, const T& b) const { return a + b; }
+};
 
-struct seg2d{
-	ll n;
-	vector<vll> seg;
+template<typename T = ll, typename Op = plus_op<T>> struct seg2d{
+	ll n, W;
+	T neutral;
+	Op op;
+	vector<T> seg;
 
-	seg2d(ll n_, vector<vll>& init) : n(n_), seg(2 * (n+1), vll(2 * (n+1), 0)) {
-		forn(i,0,n) forn(j,0,n)
-			seg[i + n][j + n] = init[i][j];
-		for (ll x = 2*n; x; x--) for (ll y = 2*n; y; y--) {
-			if (x < n) seg[x][y] = seg[2*x][y] + seg[2*x+1][y];
-			if (y < n) seg[x][y] = seg[x][2*y] + seg[x][2*y+1];
+	seg2d(ll n_, vector<vector<T>>& init, T neutral_ = T(), Op op_ = Op())
+		: n(n_), W((2*n + 7) & ~7ll), neutral(neutral_), op(op_), seg(2*n * W, neutral_) {
+		forn(x,0,n) {
+			T* r = &seg[(x + n) * W];
+			copy(init[x].begin(), init[x].begin() + n, r + n);
+			for (ll y = n-1; y; y--) r[y] = op(r[2*y], r[2*y+1]);
+		}
+		for (ll x = n-1; x; x--) {
+			T *a = &seg[2*x * W], *b = &seg[(2*x+1) * W], *c = &seg[x * W];
+			forn(y,1,2*n) c[y] = op(a[y], b[y]);
 		}
 	}
-	
-	ll query(ll x1, ll y1, ll x2, ll y2) {
-		ll ret = 0, y3 = y1 + n, y4 = y2 + n;
-		for (x1 += n, x2 += n; x1 <= x2; ++x1 /= 2, --x2 /= 2)
-		for (y1 = y3, y2 = y4; y1 <= y2; ++y1 /= 2, --y2 /= 2) {
-			if (x1%2 == 1 && y1%2 == 1) ret += seg[x1][y1];
-			if (x1%2 == 1 && y2%2 == 0) ret += seg[x1][y2];
-			if (x2%2 == 0 && y1%2 == 1) ret += seg[x2][y1];
-			if (x2%2 == 0 && y2%2 == 0) ret += seg[x2][y2];
+
+	T& at(ll x, ll y) { return seg[x * W + y]; }
+
+	T query(ll x1, ll y1, ll x2, ll y2) {
+		T ret = neutral;
+		ll y3 = y1 + n, y4 = y2 + n;
+		for (x1 += n, x2 += n; x1 <= x2; ++x1 /= 2, --x2 /= 2) {
+			T *a = &seg[x1 * W], *b = &seg[x2 * W];
+			for (y1 = y3, y2 = y4; y1 <= y2; ++y1 /= 2, --y2 /= 2) {
+				if (x1%2 == 1 && y1%2 == 1) ret = op(ret, a[y1]);
+				if (x1%2 == 1 && y2%2 == 0) ret = op(ret, a[y2]);
+				if (x2%2 == 0 && y1%2 == 1) ret = op(ret, b[y1]);
+				if (x2%2 == 0 && y2%2 == 0) ret = op(ret, b[y2]);
+			}
 		}
 		return ret;
 	}
-	
-	void update(ll x, ll y, ll val) {
+
+	void update(ll x, ll y, T val) {
 		ll y2 = y += n;
 		for (x += n; x; x /= 2, y = y2) {
-			if (x >= n) seg[x][y] = val;
-			else seg[x][y] = seg[2*x][y] + seg[2*x+1][y];
-			
-			while (y /= 2) seg[x][y] = seg[x][2*y] + seg[x][2*y+1];
+			if (x >= n) at(x, y) = val;
+			else at(x, y) = op(at(2*x, y), at(2*x+1, y));
+
+			while (y /= 2) at(x, y) = op(at(x, 2*y), at(x, 2*y+1));
 		}
 	}
-};
\ No newline at end of file
+};
@@ -0,0 +1,58 @@
+// Offline 2D Range Sum (BIT of BITs)
+//
+// Same interface as seg2d for huge coordinates: every point that will ever be
+// updated is given up front. Fenwick over compressed x, where node i keeps the
+// sorted y's of its points and a Fenwick over them.
+// update(x, y, val) sets the value of (x, y) to val; (x, y) must be in pts
+// query(x1, y1, x2, y2) sums the rectangle, bounds inclusive
+//
+// complexity: build O(n log^2 n), query/update O(log^2 n), memory O(n log n)
+
+template<typename T = ll> struct seg2d_offline {
+    vll xs;
+    vector<pll> pts;
+    vector<T> val;
+    vector<vll> ys;
+    vector<vector<T>> ft;
+
+    seg2d_offline(vector<pll> p) : pts(p) {
+        sort(pts.begin(), pts.end());
+        pts.erase(unique(pts.begin(), pts.end()), pts.end());
+        for (auto [x, y] : pts) xs.push_back(x);
+        xs.erase(unique(xs.begin(), xs.end()), xs.end());
+        ll m = sz(xs);
+        val.assign(sz(pts), 0), ys.resize(m + 1), ft.resize(m + 1);
+        for (auto [x, y] : pts)
+            for (ll i = xid(x) + 1; i <= m; i += i & -i) ys[i].push_back(y);
+        forn(i, 1, m + 1) {
+            sort(ys[i].begin(), ys[i].end());
+            ys[i].erase(unique(ys[i].begin(), ys[i].end()), ys[i].end());
+            ft[i].assign(sz(ys[i]) + 1, 0);
+        }
+    }
+
+    ll xid(ll x) { return lower_bound(xs.begin(), xs.end(), x) - xs.begin(); }
+
+    void update(ll x, ll y, T v) {
+        ll p = lower_bound(pts.begin(), pts.end(), pll(x, y)) - pts.begin();
+        T d = v - val[p];
+        val[p] = v;
+        for (ll i = xid(x) + 1; i < sz(ft); i += i & -i) {
+            ll j = lower_bound(ys[i].begin(), ys[i].end(), y) - ys[i].begin() + 1;
+            for (; j < sz(ft[i]); j += j & -j) ft[i][j] += d;
+        }
+    }
+
+    // soma dos pontos com x' <= x, y' <= y
+    T pref(ll x, ll y) {
+        T ret = 0;
+        for (ll i = upper_bound(xs.begin(), xs.end(), x) - xs.begin(); i; i -= i & -i)
+            for (ll j = upper_bound(ys[i].begin(), ys[i].end(), y) - ys[i].begin(); j; j -= j & -j)
+                ret += ft[i][j];
+        return ret;
+    }
+
+    T query(ll x1, ll y1, ll x2, ll y2) {
+        return pref(x2, y2) - pref(x1 - 1, y2) - pref(x2, y1 - 1) + pref(x1 - 1, y1 - 1);
+    }
+};
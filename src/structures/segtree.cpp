@@ -1,6 +1,7 @@
 // Segment Tree (Range Query + Point Update)
 //
 //supports point updates and range queries.
+// Batch update/query: segtree_batch.cpp.
 //
 // complexity: O(log N) per op, O(N)
 
@@ -0,0 +1,39 @@
+// Segment Tree Batch Operations
+//
+// segtree_batch<T> is segtree<T> (segtree.cpp) plus batch operations.
+// update_batch writes all leaves and then recomputes each touched ancestor once,
+// level by level; query_batch answers in leaf order for locality.
+//
+// complexity: O(K log K + distinct ancestors) per batch
+
+#include "src/structures/segtree.cpp"
+
+template<typename T> struct segtree_batch : segtree<T> {
+  using segtree<T>::segtree, segtree<T>::n, segtree<T>::neutral, segtree<T>::tree, segtree<T>::query;
+
+  void update_batch(vector<pair<ll, T>> upd) {
+    stable_sort(upd.begin(), upd.end(), [](auto &a, auto &b) { return a.first < b.first; });
+    vll cur;
+    for (auto &[i, v] : upd) {
+      tree[i + n] = v; // last write to a leaf wins
+      if (cur.empty() || cur.back() != (i + n) / 2) cur.push_back((i + n) / 2);
+    }
+    while (!cur.empty() && cur[0] > 0) { // cur[0] == 0 only when n == 1
+      vll nxt;
+      for (ll i : cur) {
+        tree[i] = T::comb(tree[2 * i], tree[2 * i + 1]);
+        if (i > 1 && (nxt.empty() || nxt.back() != i / 2)) nxt.push_back(i / 2);
+      }
+      swap(cur, nxt);
+    }
+  }
+
+  vector<T> query_batch(const vector<pll> &qs) {
+    vll ord(sz(qs));
+    iota(ord.begin(), ord.end(), 0);
+    sort(ord.begin(), ord.end(), [&](ll a, ll b) { return qs[a] < qs[b]; });
+    vector<T> ret(sz(qs), neutral);
+    for (ll k : ord) ret[k] = query(qs[k].first, qs[k].second);
+    return ret;
+  }
+};
@@ -1,6 +1,9 @@
 // Segment Tree (Range Query + Range Update)
 //
 // Tree for range queries with a customizable combine; supports range updates and range queries.
+// Bottom-up and non-recursive: each node keeps its value and pending update side by side,
+// a node is clean when its update equals noop, and the push/pull walks of both borders
+// are fused so the shared path to the root is visited once.
 //
 // complexity: O(log N) per op, O(N) to build
 
@@ -30,85 +33,84 @@ struct Update {
         }
         return res;
     }
+
+    bool operator==(const Update &o) const = default;
 };
 
 template<typename T, typename U> struct segtree {
-  ll s, h;
+  struct item { T val; U prop; };
 
+  ll s, h;
   T id;
-  vector<T> val;
-
   U noop;
-  vector<bool> dirty;
-  vector<U> prop;
+  vector<item> t;
 
   segtree(ll ts, T tid = T(), U tnoop = U()) {
     id = tid, noop = tnoop;
     for (s = 1, h = 1; s < ts; ) s *= 2, h++;
 
-    val.assign(2*s, id);
-    dirty.assign(2*s, false);
-    prop.assign(2*s, noop);
+    t.assign(2*s, {id, noop});
   }
 
   void set_leaves(vector<T> &lvs) {
-    copy(lvs.begin(), lvs.end(), val.begin() + s);
+    t.assign(2*s, {id, noop});
+    forn(i, 0, sz(lvs)) t[s + i].val = lvs[i];
 
-    for (ll i = s - 1; i > 0; i--) val[i] = val[2 * i] * val[2 * i + 1];
-    dirty.assign(2*s, false);
-    prop.assign(2*s, noop);
+    for (ll i = s - 1; i > 0; i--) t[i].val = t[2*i].val * t[2*i+1].val;
   }
 
-  void apply(ll i, U &upd) {
-    val[i] = upd(val[i]);
-    if(i < s) {
-      prop[i] = prop[i] + upd;
-      dirty[i] = true;
-    }
+  void apply(ll i, const U &upd) {
+    t[i].val = upd(t[i].val);
+    if (i < s) t[i].prop = t[i].prop + upd;
   }
 
-  void pull(ll i) {
-    for (ll l = i/2; l; l /= 2) {
-      T comb = val[2*l] * val[2*l+1];
-      val[l] = prop[l](comb);
-    }
+  void push_node(ll l) {
+    if (t[l].prop == noop) return;
+    apply(2*l, t[l].prop);
+    apply(2*l+1, t[l].prop);
+    t[l].prop = noop;
   }
 
-  void push(ll i) {
-    for (ll th = h; th > 0; th--) {
-      ll l = i >> th;
+  void pull_node(ll l) {
+    t[l].val = t[l].prop(t[2*l].val * t[2*l+1].val);
+  }
 
-      if (dirty[l]) {
-        apply(2*l, prop[l]);
-        apply(2*l+1, prop[l]);
+  void push(ll i, ll j) { // top-down over the ancestors of leaves i and j
+    for (ll th = h - 1; th > 0; th--) {
+      ll l = i >> th, r = j >> th;
+      push_node(l);
+      if (r != l) push_node(r);
+    }
+  }
 
-        prop[l] = noop;
-        dirty[l] = false;
-      }
+  void pull(ll i, ll j) { // bottom-up, stops duplicating once the paths meet
+    for (i /= 2, j /= 2; i; i /= 2, j /= 2) {
+      pull_node(i);
+      if (j != i) pull_node(j);
     }
   }
 
   void update(ll i, ll j, U upd) {
     i += s, j += s;
-    push(i), push(j);
+    push(i, j);
 
     for (ll l = i, r = j; l <= r; l /= 2, r /= 2) {
       if((l&1) == 1) apply(l++, upd);
       if((r&1) == 0) apply(r--, upd);
     }
 
-    pull(i), pull(j);
+    pull(i, j);
   }
 
   T query(ll i, ll j){
     i += s, j += s;
-    push(i), push(j);
+    push(i, j);
 
     T rl = id, rr = id;
     for(; i <= j; i /= 2, j /= 2){
-      if((i&1) == 1) rl = rl * val[i++];
-      if((j&1) == 0) rr = val[j--] * rr;
+      if((i&1) == 1) rl = rl * t[i++].val;
+      if((j&1) == 0) rr = t[j--].val * rr;
     }
     return rl * rr;
   }
-};
\ No newline at end of file
+};
@@ -0,0 +1,63 @@
+// Wide Segment Tree (B-ary, Range Query + Point Update)
+//
+// Same interface as segtree<T> (T::comb, neutral), but each node covers B children
+// stored contiguously: with B = 8 and 64-bit values a node is one cache line and the
+// per-node combine loops have fixed length, so they vectorize (see pragmas.cpp, avx2).
+// Level 0 holds the leaves; every level is padded with neutral to a multiple of B.
+// T::comb must be associative; order is preserved, so it need not be commutative.
+//
+// complexity: O(B log_B N) per op, O(N)
+
+template<typename T, ll B = 8> struct segtree_wide {
+  ll n;
+  T neutral;
+  vll off; // off[k]: start of level k in t
+  vector<T> t;
+
+  segtree_wide(ll _n, T _neutral = T()) : n(_n), neutral(_neutral) {
+    ll tot = 0;
+    for (ll m = n; ; m = (m + B - 1) / B) {
+      off.push_back(tot);
+      tot += (m + B - 1) / B * B;
+      if (m <= 1) break;
+    }
+    t.assign(tot, neutral);
+  }
+
+  T block(ll k, ll i) { // comb of the B children of node i at level k+1
+    T acc = neutral;
+    T* a = &t[off[k] + i * B];
+    for (ll x = 0; x < B; x++) acc = T::comb(acc, a[x]);
+    return acc;
+  }
+
+  void set_leaves(vector<T> &leaves) {
+    copy(leaves.begin(), leaves.end(), t.begin());
+    for (ll k = 0; k + 1 < sz(off); k++)
+      for (ll i = 0; off[k] + i * B < off[k+1]; i++) t[off[k+1] + i] = block(k, i);
+  }
+
+  void update(ll i, T v) {
+    t[i] = v;
+    for (ll k = 0; k + 1 < sz(off); k++) {
+      i /= B;
+      t[off[k+1] + i] = block(k, i);
+    }
+  }
+
+  T query(ll i, ll j) {
+    T rl = neutral, rr = neutral;
+    j++;
+    for (ll k = 0; ; k++) {
+      T* a = &t[off[k]];
+      ll bl = (i + B - 1) / B, br = j / B;
+      if (bl >= br) { // no full node inside [i, j) at this level
+        for (; i < j; i++) rl = T::comb(rl, a[i]);
+        return T::comb(rl, rr);
+      }
+      for (ll x = i; x < bl * B; x++) rl = T::comb(rl, a[x]);
+      for (ll x = j - 1; x >= br * B; x--) rr = T::comb(a[x], rr);
+      i = bl, j = br;
+    }
+  }
+};
@@ -1,26 +1,36 @@
 // Sparse Table (Idempotent Range Query)
 //
 // Preprocesses static array to answer idempotent range queries (e.g., min/max) in O(1) after O(N log N) build.
+// Levels are stored contiguously in one buffer (m[j*n + i] covers [i, i + 2^j)), so each
+// level is built by a single vectorizable loop. Op must be idempotent: min (default), max,
+// gcd, and/or, or min over pll {value, index} for argmin. Ex.:
+//   auto g = [](ll a, ll b) { return gcd(a, b); };
+//   sparse<ll, decltype(g)> s(v, g);
 //
 // complexity: O(N log N) build, O(1) query; O(N log N) space
 
-struct sparse {
-    vector<vll> m;
-    
-    sparse(vll& v) {
-        ll n = sz(v);
-        ll logn = 64 - __builtin_clzll(n - 1);
-        m.resize(n+1, vll(logn+1));
+template<typename T> struct min_op {
+    T operator()(const T& a, const T& b) const { return min(a, b); }
+};
 
-        forn(i, 0, n) m[i][0] = v[i];
+template<typename T = ll, typename Op = min_op<T>> struct sparse {
+    ll n;
+    vector<T> m;
+    Op op;
 
-        for (ll j = 1; (1 << j) <= n; j++)
-        for (ll i = 0; i + (1 << j) <= n; i++)
-            m[i][j] = min(m[i][j-1], m[i + (1 << (j-1))][j-1]);    
+    sparse(const vector<T>& v, Op op_ = Op()) : n(sz(v)), op(op_) {
+        ll lg = 64 - __builtin_clzll(max(n, 1ll));
+        m.resize(lg * n);
+        copy(v.begin(), v.end(), m.begin());
+        for (ll j = 1; j < lg; j++) {
+            T *a = &m[(j-1) * n], *c = &m[j * n];
+            ll h = 1ll << (j-1);
+            for (ll i = 0; i + 2*h <= n; i++) c[i] = op(a[i], a[i + h]);
+        }
     }
-    
-    ll query(ll a, ll b) { 
-        ll j = __builtin_clzll(1) - __builtin_clzll(b - a + 1);
-        return min(m[a][j], m[b - (1 << j) + 1][j]);
+
+    T query(ll a, ll b) {
+        ll j = __lg(b - a + 1);
+        return op(m[j*n + a], m[j*n + b - (1ll << j) + 1]);
     }
-};
\ No newline at end of file
+};
@@ -1,54 +1,82 @@
 // Implicit Treap (Sequence Treap)
 //
 // Maintains a sequence with split and merge operations using randomized priorities and subtree sizes.
+// Nodes live in a contiguous arena addressed by 32-bit indices (0 is the empty tree),
+// so split and merge never allocate. Lazy tags: range add, range reverse; keeps range sums.
 //
 // complexity: O(log N) expected per op, O(N)
 
-struct Treap{
-    ll val;
-    ll prio, size;
-    vector<Treap*> kids;
-    Treap(ll c): val(c), prio(rand()), size(1), 
-        kids({NULL,NULL}){}; 
-};
+struct treap {
+    struct node {
+        ll val, sum, lz;
+        uint32_t pr, size, l, r;
+        bool rev;
+    };
+    vector<node> t;
+    uint32_t root = 0, seed = 2463534242u;
 
-ll size(Treap *me){return me ? me->size : 0;}
-void rsz(Treap* me){me -> size = 
-    1 + size(me->kids[0]) + size(me->kids[1]);}
+    treap(ll cap = 0) : t(1) { t.reserve(cap + 1); }
 
-vector<Treap*> split(Treap *me, ll idx){
-    if(!me) return {NULL,NULL};
-    vector<Treap*> out;
+    uint32_t xrand() { return seed ^= seed << 13, seed ^= seed >> 17, seed ^= seed << 5; }
+    uint32_t new_node(ll v) {
+        t.push_back({v, v, 0, xrand(), 1, 0, 0, false});
+        return sz(t) - 1;
+    }
+    void apply(uint32_t x, ll add, bool rev) {
+        if (!x) return;
+        t[x].val += add, t[x].sum += add * t[x].size, t[x].lz += add;
+        if (rev) swap(t[x].l, t[x].r), t[x].rev ^= 1;
+    }
+    void push(uint32_t x) {
+        if (!t[x].lz && !t[x].rev) return;
+        apply(t[x].l, t[x].lz, t[x].rev), apply(t[x].r, t[x].lz, t[x].rev);
+        t[x].lz = 0, t[x].rev = false;
+    }
+    void pull(uint32_t x) {
+        node &a = t[t[x].l], &b = t[t[x].r];
+        t[x].size = 1 + a.size + b.size;
+        t[x].sum = t[x].val + a.sum + b.sum;
+    }
 
-    if(size(me->kids[0]) < idx){
-        auto aux = split(me->kids[1], 
-            idx - size(me->kids[0]) -1);
-        me->kids[1] = aux[0];
-        rsz(me);
-        out = {me, aux[1]};
-    }else{
-        auto aux = split(me->kids[0], idx);
-        me->kids[0] = aux[1];
-        rsz(me);
-        out = {aux[0], me};
-    }
-    return out;
-}
+    // first k elements of x go to a, the rest to b
+    void split(uint32_t x, ll k, uint32_t &a, uint32_t &b) {
+        if (!x) { a = b = 0; return; }
+        push(x);
+        if (t[t[x].l].size < k) split(t[x].r, k - t[t[x].l].size - 1, t[x].r, b), a = x;
+        else split(t[x].l, k, a, t[x].l), b = x;
+        pull(x);
+    }
+    uint32_t merge(uint32_t a, uint32_t b) {
+        if (!a || !b) return a ^ b;
+        if (t[a].pr > t[b].pr) {
+            push(a), t[a].r = merge(t[a].r, b), pull(a);
+            return a;
+        }
+        push(b), t[b].l = merge(a, t[b].l), pull(b);
+        return b;
+    }
 
-Treap* merge(Treap *left, Treap *right){
-    if(left == NULL) return right;
-    if(right == NULL) return left; 
-    
-    Treap* out;
-    
-    if(left->prio < right->prio){
-        left->kids[1] = merge(left->kids[1], right);
-        rsz(left);
-        out = left;
-    }else{
-        right->kids[0] = merge(left, right->kids[0]);
-        rsz(right);
-        out = right;
-    }
-    return out;
-}
+    void insert(ll pos, ll v) {
+        uint32_t a, b;
+        split(root, pos, a, b);
+        root = merge(merge(a, new_node(v)), b);
+    }
+    void erase(ll pos) { // o no fica no arena, sem reuso
+        uint32_t a, b, c;
+        split(root, pos, a, b), split(b, 1, b, c);
+        root = merge(a, c);
+    }
+    template<class F> void range(ll l, ll r, F f) { // f(raiz de [l, r])
+        uint32_t a, b, c;
+        split(root, l, a, b), split(b, r - l + 1, b, c);
+        f(b);
+        root = merge(merge(a, b), c);
+    }
+    void update(ll l, ll r, ll x) { range(l, r, [&](uint32_t m) { apply(m, x, false); }); }
+    void reverse(ll l, ll r) { range(l, r, [&](uint32_t m) { apply(m, 0, true); }); }
+    ll query(ll l, ll r) {
+        ll ret;
+        range(l, r, [&](uint32_t m) { ret = t[m].sum; });
+        return ret;
+    }
+};
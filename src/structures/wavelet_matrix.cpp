@@ -0,0 +1,85 @@
+// Wavelet Matrix
+//
+// Static sequence index over vll; values are compressed internally, so any ll works.
+// Each of the log(sigma) levels is a bitvector with a popcount rank per 64-bit word,
+// about n log(sigma) bits in total. Queries are 0-based and inclusive:
+// kth(l, r, k): k-th smallest (0-based) of a[l..r]
+// rank(x, r): occurrences of x in a[0..r]
+// range_freq(l, r, lo, hi): how many a[i], l <= i <= r, have lo <= a[i] < hi
+// prev_value / next_value: largest < x / smallest >= x in a[l..r] (-INF / INF if none)
+//
+// complexity: O(log sigma) per query, O(n log sigma) build
+
+struct bitvec {
+    vector<uint64_t> b;
+    vector<uint32_t> cnt; // cnt[i]: uns em b[0..i)
+    bitvec(ll n = 0) : b(n/64 + 1), cnt(n/64 + 2) {}
+    void set(ll i) { b[i >> 6] |= 1ull << (i & 63); }
+    void build() { forn(i, 0, sz(b)) cnt[i+1] = cnt[i] + __builtin_popcountll(b[i]); }
+    ll rank1(ll i) { // uns em [0, i)
+        return cnt[i >> 6] + __builtin_popcountll(b[i >> 6] & ((1ull << (i & 63)) - 1));
+    }
+    ll rank0(ll i) { return i - rank1(i); }
+};
+
+struct wavelet_matrix {
+    ll n, lg;
+    vll vals, zeros;
+    vector<bitvec> bv;
+
+    wavelet_matrix(vll v) : n(sz(v)), vals(v) {
+        sort(vals.begin(), vals.end());
+        vals.erase(unique(vals.begin(), vals.end()), vals.end());
+        for (ll& x : v) x = lower_bound(vals.begin(), vals.end(), x) - vals.begin();
+        lg = max(1ll, 64 - (ll)__builtin_clzll(max<ll>(sz(vals) - 1, 1)));
+        zeros.resize(lg), bv.assign(lg, bitvec(n));
+        vll nxt(n);
+        for (ll h = lg - 1; h >= 0; h--) {
+            forn(i, 0, n) if (v[i] >> h & 1) bv[h].set(i);
+            bv[h].build();
+            zeros[h] = bv[h].rank0(n);
+            ll z = 0, o = zeros[h];
+            forn(i, 0, n) (v[i] >> h & 1 ? nxt[o++] : nxt[z++]) = v[i];
+            swap(v, nxt);
+        }
+    }
+
+    ll id(ll x) { return lower_bound(vals.begin(), vals.end(), x) - vals.begin(); }
+
+    ll kth(ll l, ll r, ll k) {
+        ll ret = 0;
+        r++;
+        for (ll h = lg - 1; h >= 0; h--) {
+            ll l0 = bv[h].rank0(l), r0 = bv[h].rank0(r);
+            if (k < r0 - l0) l = l0, r = r0;
+            else {
+                k -= r0 - l0, ret |= 1ll << h;
+                l += zeros[h] - l0, r += zeros[h] - r0;
+            }
+        }
+        return vals[ret];
+    }
+    ll count_less_id(ll l, ll r, ll x) { // a[l..r) < vals[x]
+        if (x >= (1ll << lg)) return r - l;
+        ll ret = 0;
+        for (ll h = lg - 1; h >= 0; h--) {
+            ll l0 = bv[h].rank0(l), r0 = bv[h].rank0(r);
+            if (x >> h & 1) ret += r0 - l0, l += zeros[h] - l0, r += zeros[h] - r0;
+            else l = l0, r = r0;
+        }
+        return ret;
+    }
+    ll count_less(ll l, ll r, ll x) { return count_less_id(l, r + 1, id(x)); }
+    ll range_freq(ll l, ll r, ll lo, ll hi) {
+        return lo < hi ? count_less(l, r, hi) - count_less(l, r, lo) : 0;
+    }
+    ll rank(ll x, ll r) { return range_freq(0, r, x, x + 1); }
+    ll prev_value(ll l, ll r, ll x) {
+        ll c = count_less(l, r, x);
+        return c ? kth(l, r, c - 1) : -INF;
+    }
+    ll next_value(ll l, ll r, ll x) {
+        ll c = count_less(l, r, x);
+        return c <= r - l ? kth(l, r, c) : INF;
+    }
+};
@@ -0,0 +1,33 @@
+#include "src/extra/template.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vector<pll> P(n);
+    for (auto& [x, y] : P) cin >> x >> y;
+    vector<array<ll, 5>> ops(q);
+    for (auto& o : ops) {
+        cin >> o[0] >> o[1] >> o[2];
+        if (o[0] == 1) cin >> o[3];
+        if (o[0] == 3) cin >> o[3] >> o[4];
+    }
+    forn(rep, 0, 2) for (auto [k, a, b, c, d] : ops) {
+        vll ds;
+        for (auto [x, y] : P) ds.push_back((x-a)*(x-a) + (y-b)*(y-b));
+        sort(ds.begin(), ds.end());
+        if (k == 1) {
+            ll m = max(0ll, min(c, n));
+            cout << m;
+            forn(i, 0, m) cout << " " << ds[i];
+            cout << ln;
+        } else if (k == 2) cout << ds[0] << ln;
+        else {
+            vector<pll> r;
+            for (auto [x, y] : P) if (a <= x && x <= c && b <= y && y <= d) r.push_back({x, y});
+            sort(r.begin(), r.end());
+            cout << sz(r);
+            for (auto [x, y] : r) cout << " " << x << " " << y;
+            cout << ln;
+        }
+    }
+}
@@ -0,0 +1,44 @@
+// Test: geometry/kdtree
+//
+// Input:
+//   N Q
+//   N lines "x y" (duplicates and collinear sets are common)
+//   Q operations:
+//     "1 x y k"          knn of (x, y) with k (k may be <= 0 or > N)
+//     "2 x y"            nearest to (x, y) (only when N > 0)
+//     "3 x1 y1 x2 y2"    points in [x1, x2] x [y1, y2]
+//
+// Output (twice, for geo_int and geo_double):
+//   "1": the number of points returned, then their squared distances in order
+//   "2": the squared distance of the nearest point
+//   "3": the count, then the reported points sorted ("x y" each)
+
+#include "src/extra/template.cpp"
+#include "src/extra/random.cpp"
+
+int main(int argc, char* argv[]) {
+    rng.seed(atoll(argv[1]));
+    ll n = uniform(0, 40), q = uniform(1, 30), mode = uniform(0, 3);
+    ll c = mode == 3 ? 1000000000 : uniform(1, 6);
+    cout << n << " " << q << ln;
+    ll a = uniform(-3, 3), b = uniform(-c, c);
+    forn(i, 0, n) {
+        ll x = uniform(-c, c), y = uniform(-c, c);
+        if (mode == 1) y = a * x + b;     // colineares
+        if (mode == 2) x = b;             // reta vertical
+        cout << x << " " << y << ln;
+    }
+    ll v = mode == 3 ? c : 3 * c + abs(b) + 2;
+    forn(i, 0, q) {
+        ll t = uniform(1, 3);
+        if (t == 2 && n == 0) t = 1;
+        if (t == 1) cout << "1 " << uniform(-v, v) << " " << uniform(-v, v) << " " << uniform(-2, n + 3) << ln;
+        else if (t == 2) cout << "2 " << uniform(-v, v) << " " << uniform(-v, v) << ln;
+        else {
+            ll x1 = uniform(-v, v), x2 = uniform(-v, v), y1 = uniform(-v, v), y2 = uniform(-v, v);
+            if (x1 > x2) swap(x1, x2);
+            if (y1 > y2) swap(y1, y2);
+            cout << "3 " << x1 << " " << y1 << " " << x2 << " " << y2 << ln;
+        }
+    }
+}
@@ -0,0 +1,60 @@
+// Test: geometry/kdtree (knn, nearest, rectangle count/report; geo_int and geo_double)
+
+#include "src/extra/template.cpp"
+
+namespace I {
+#include "src/geometry/geo_int.cpp"
+#include "src/geometry/kdtree.cpp"
+}
+namespace D {
+#include "src/geometry/geo_double.cpp"
+#include "src/geometry/kdtree.cpp"
+}
+
+ll n;
+vector<pll> P;
+vector<array<ll, 5>> ops;
+
+template<class Pt, class KD> void run() {
+    vector<Pt> v;
+    for (auto [x, y] : P) v.push_back(Pt(x, y));
+    KD t(v);
+    for (auto [k, a, b, c, d] : ops) {
+        if (k == 1) {
+            auto r = t.knn(Pt(a, b), c);
+            cout << sz(r);
+            for (auto [dd, p] : r) {
+                // o ponto devolvido tem que existir e estar a distancia dd
+                bool ok = count(P.begin(), P.end(), pll(p.x, p.y)) && (p.x-a)*(p.x-a) + (p.y-b)*(p.y-b) == dd;
+                cout << " " << (ok ? (ll)dd : -1);
+            }
+            cout << ln;
+        } else if (k == 2) {
+            auto [dd, p] = t.nearest(Pt(a, b));
+            bool ok = count(P.begin(), P.end(), pll(p.x, p.y)) && (p.x-a)*(p.x-a) + (p.y-b)*(p.y-b) == dd;
+            cout << (ok ? (ll)dd : -1) << ln;
+        } else {
+            vector<pll> r;
+            for (auto& p : t.report(a, b, c, d)) r.push_back({(ll)p.x, (ll)p.y});
+            sort(r.begin(), r.end());
+            cout << t.count(a, b, c, d);
+            for (auto [x, y] : r) cout << " " << x << " " << y;
+            cout << ln;
+        }
+    }
+}
+
+int main() {
+    _;
+    ll q; cin >> n >> q;
+    P.resize(n);
+    for (auto& [x, y] : P) cin >> x >> y;
+    ops.resize(q);
+    for (auto& o : ops) {
+        cin >> o[0] >> o[1] >> o[2];
+        if (o[0] == 1) cin >> o[3];
+        if (o[0] == 3) cin >> o[3] >> o[4];
+    }
+    run<I::pt, I::kdtree>();
+    run<D::pt, D::kdtree>();
+}
@@ -0,0 +1,23 @@
+// Test: structures/bit_range (range add, range sum)
+
+#include "src/extra/template.cpp"
+#include "src/structures/bit_range.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vll a(n);
+    forn(i, 0, n) cin >> a[i];
+    pmr::monotonic_buffer_resource pool;
+    BIT<> b(n, a, &pool);
+    while (q--) {
+        ll t; cin >> t;
+        if (t == 1) {
+            ll l, r, v; cin >> l >> r >> v;
+            b.update(l, r, v);
+        } else {
+            ll l, r; cin >> l >> r;
+            cout << b.query(l, r) << ln;
+        }
+    }
+}
@@ -0,0 +1,14 @@
+#include "src/extra/template.cpp"
+
+int main() {
+    _;
+    ll n, m, q; cin >> n >> m >> q;
+    vector<vll> a(n, vll(m));
+    while (q--) {
+        ll t, x1, y1, x2, y2; cin >> t >> x1 >> y1 >> x2 >> y2;
+        ll v = 0, s = 0;
+        if (t == 1) cin >> v;
+        forn(i, x1, x2+1) forn(j, y1, y2+1) a[i][j] += v, s += a[i][j];
+        if (t == 2) cout << s << ln;
+    }
+}
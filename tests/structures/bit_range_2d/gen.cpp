@@ -0,0 +1,28 @@
+// Test: structures/bit_range_2d
+//
+// Input:
+//   N M Q
+//   Q operations (grid starts at zero):
+//     "1 x1 y1 x2 y2 v"  add v to every cell of the rectangle
+//     "2 x1 y1 x2 y2"    sum of the rectangle
+//
+// Output:
+//   For each "2 ...": the sum
+
+#include "src/extra/template.cpp"
+#include "src/extra/random.cpp"
+
+int main(int argc, char* argv[]) {
+    rng.seed(atoll(argv[1]));
+    ll n = uniform(1, 10), m = uniform(1, 10);
+    ll q = uniform(1, 40);
+    cout << n << " " << m << " " << q << ln;
+    forn(i, 0, q) {
+        ll t = uniform(1, 2);
+        ll x1 = uniform(0, n - 1), x2 = uniform(x1, n - 1);
+        ll y1 = uniform(0, m - 1), y2 = uniform(y1, m - 1);
+        cout << t << " " << x1 << " " << y1 << " " << x2 << " " << y2;
+        if (t == 1) cout << " " << uniform(-100, 100);
+        cout << ln;
+    }
+}
@@ -0,0 +1,19 @@
+// Test: structures/bit_range_2d (rectangle add, rectangle sum)
+
+#include "src/extra/template.cpp"
+#include "src/structures/bit_range_2d.cpp"
+
+int main() {
+    _;
+    ll n, m, q; cin >> n >> m >> q;
+    BIT2D<> b(n, m);
+    while (q--) {
+        ll t, x1, y1, x2, y2; cin >> t >> x1 >> y1 >> x2 >> y2;
+        if (t == 1) {
+            ll v; cin >> v;
+            b.update(x1, y1, x2, y2, v);
+        } else {
+            cout << b.query(x1, y1, x2, y2) << ln;
+        }
+    }
+}
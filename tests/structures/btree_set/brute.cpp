@@ -0,0 +1,25 @@
+#include "src/extra/template.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    set<ll> s;
+    forn(i, 0, n) {
+        ll x; cin >> x;
+        s.insert(x);
+    }
+    while (q--) {
+        ll t, x; cin >> t >> x;
+        if (t == 1) cout << s.insert(x).second << ln;
+        else if (t == 2) cout << s.erase(x) << ln;
+        else if (t == 3) {
+            if (x >= sz(s)) cout << "none" << ln;
+            else cout << *next(s.begin(), x) << ln;
+        } else if (t == 4) cout << distance(s.begin(), s.lower_bound(x)) << ln;
+        else {
+            auto it = s.lower_bound(x);
+            if (it != s.end()) cout << *it << ln;
+            else cout << "none" << ln;
+        }
+    }
+}
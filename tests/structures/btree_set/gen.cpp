@@ -0,0 +1,33 @@
+// Test: structures/btree_set
+//
+// Input:
+//   N Q
+//   N sorted distinct keys (bulk build)
+//   Q operations:
+//     "1 x"  insert x, print 1 if it was new else 0
+//     "2 x"  erase x, print 1 if it was present else 0
+//     "3 k"  k-th smallest (0-based), or "none" if k >= size
+//     "4 x"  number of keys < x
+//     "5 x"  smallest key >= x, or "none"
+//
+// Output:
+//   One line per operation
+
+#include "src/extra/template.cpp"
+#include "src/extra/random.cpp"
+
+int main(int argc, char* argv[]) {
+    rng.seed(atoll(argv[1]));
+    ll v = uniform(0, 1) ? 30 : 300;
+    ll n = uniform(0, v / 2), q = uniform(1, 200);
+    set<ll> s;
+    while (sz(s) < n) s.insert(uniform(-v, v));
+    cout << n << " " << q << ln;
+    for (ll x : s) cout << x << " ";
+    cout << ln;
+    forn(i, 0, q) {
+        ll t = uniform(1, 5);
+        if (t == 3) cout << "3 " << uniform(0, n + i) << ln;
+        else cout << t << " " << uniform(-v - 1, v + 1) << ln;
+    }
+}
@@ -0,0 +1,26 @@
+// Test: structures/btree_set (small fanout to force splits)
+
+#include "src/extra/template.cpp"
+#include "src/structures/btree_set.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vll a(n);
+    forn(i, 0, n) cin >> a[i];
+    btree_set<ll, 3> s(a);
+    while (q--) {
+        ll t, x; cin >> t >> x;
+        if (t == 1) cout << s.insert(x) << ln;
+        else if (t == 2) cout << s.erase(x) << ln;
+        else if (t == 3) {
+            if (x >= s.size()) cout << "none" << ln;
+            else cout << s.find_by_order(x) << ln;
+        } else if (t == 4) cout << s.order_of_key(x) << ln;
+        else {
+            ll* p = s.lower_bound(x);
+            if (p) cout << *p << ln;
+            else cout << "none" << ln;
+        }
+    }
+}
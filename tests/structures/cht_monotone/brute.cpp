@@ -0,0 +1,16 @@
+#include "src/extra/template.cpp"
+
+int main() {
+    _;
+    ll q; cin >> q;
+    vector<pll> lines;
+    while (q--) {
+        ll t, a, b; cin >> t >> a;
+        if (t == 1) cin >> b, lines.push_back({a, b});
+        else {
+            ll r = -INF;
+            for (auto [m, c] : lines) r = max(r, m * a + c);
+            cout << r << ln;
+        }
+    }
+}
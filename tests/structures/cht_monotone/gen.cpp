@@ -0,0 +1,31 @@
+// Test: structures/cht_monotone
+//
+// Input:
+//   Q
+//   Q operations (first one is an add):
+//     "1 a b"  add line ax + b (a nondecreasing)
+//     "2 x"    max over lines at x (x nondecreasing)
+//
+// Output:
+//   One line per "2 x"
+
+#include "src/extra/template.cpp"
+#include "src/extra/random.cpp"
+
+int main(int argc, char* argv[]) {
+    rng.seed(atoll(argv[1]));
+    ll q = uniform(1, 60), v = uniform(0, 1) ? 5 : 1000000;
+    vll t(q, 1);
+    forn(i, 1, q) t[i] = uniform(1, 2);
+    ll na = count(t.begin(), t.end(), 1), nx = q - na;
+    vll as(na), xs(nx);
+    for (ll& a : as) a = uniform(-v, v);
+    for (ll& x : xs) x = uniform(-v, v);
+    sort(as.begin(), as.end()), sort(xs.begin(), xs.end());
+    cout << q << ln;
+    ll ia = 0, ix = 0;
+    forn(i, 0, q) {
+        if (t[i] == 1) cout << "1 " << as[ia++] << " " << uniform(-v * v, v * v) << ln;
+        else cout << "2 " << xs[ix++] << ln;
+    }
+}
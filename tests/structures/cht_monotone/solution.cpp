@@ -0,0 +1,15 @@
+// Test: structures/cht_monotone (monotone slopes and queries, max)
+
+#include "src/extra/template.cpp"
+#include "src/structures/cht_monotone.cpp"
+
+int main() {
+    _;
+    ll q; cin >> q;
+    mono_cht<> c;
+    while (q--) {
+        ll t, a, b; cin >> t >> a;
+        if (t == 1) cin >> b, c.add(a, b);
+        else cout << c.query(a) << ln;
+    }
+}
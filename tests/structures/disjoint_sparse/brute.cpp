@@ -0,0 +1,16 @@
+#include "src/extra/template.cpp"
+
+const ll MOD = 998244353;
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vector<pll> v(n);
+    for (auto& [a, b] : v) cin >> a >> b;
+    while (q--) {
+        ll l, r; cin >> l >> r;
+        ll a = 1, b = 0;
+        forn(i, l, r + 1) a = a * v[i].first % MOD, b = (b * v[i].first + v[i].second) % MOD;
+        cout << a << " " << b << ln;
+    }
+}
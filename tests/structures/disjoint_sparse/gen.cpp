@@ -0,0 +1,24 @@
+// Test: structures/disjoint_sparse (composition of affine maps mod 998244353)
+//
+// Input:
+//   N Q
+//   N lines "a b": map x -> a*x + b
+//   Q lines "l r": composition f_l, then f_{l+1}, ..., then f_r
+//
+// Output:
+//   For each query: "a b" of the composed map
+
+#include "src/extra/template.cpp"
+#include "src/extra/random.cpp"
+
+int main(int argc, char* argv[]) {
+    rng.seed(atoll(argv[1]));
+    ll n = uniform(0, 1) ? uniform(1, 20) : uniform(1, 200);
+    ll q = uniform(1, 40);
+    cout << n << " " << q << ln;
+    forn(i, 0, n) cout << uniform(0, 998244352) << " " << uniform(0, 998244352) << ln;
+    forn(i, 0, q) {
+        ll l = uniform(0, n - 1);
+        cout << l << " " << uniform(l, n - 1) << ln;
+    }
+}
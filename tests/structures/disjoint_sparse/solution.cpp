@@ -0,0 +1,27 @@
+// Test: structures/disjoint_sparse (non-commutative combine)
+
+#include "src/extra/template.cpp"
+#include "src/structures/disjoint_sparse.cpp"
+
+const ll MOD = 998244353;
+
+struct node {
+    ll a = 1, b = 0;
+
+    static node comb(const node& x, const node& y) {
+        return {x.a * y.a % MOD, (x.b * y.a + y.b) % MOD};
+    }
+};
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vector<node> v(n);
+    for (auto& [a, b] : v) cin >> a >> b;
+    disjoint_sparse<node> ds(v);
+    while (q--) {
+        ll l, r; cin >> l >> r;
+        node x = ds.query(l, r);
+        cout << x.a << " " << x.b << ln;
+    }
+}
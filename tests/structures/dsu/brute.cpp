@@ -3,21 +3,34 @@
 int main() {
     _;
     ll n, q; cin >> n >> q;
-    vector<vll> g(n);
+    vll id(n), val(n);
+    iota(id.begin(), id.end(), 0);
     while (q--) {
-        ll t, u, v; cin >> t >> u >> v;
-        if (t == 1) {
-            g[u].push_back(v);
-            g[v].push_back(u);
+        ll t; cin >> t;
+        if (t == 1 || t == 3) {
+            ll u, v, x = 0; cin >> u >> v;
+            if (t == 3) cin >> x;
+            if (id[u] == id[v]) continue;
+            ll c = id[v], delta = val[u] + x - val[v];
+            forn(i, 0, n) if (id[i] == c) id[i] = id[u], val[i] += delta;
+        } else if (t == 2) {
+            ll u, v; cin >> u >> v;
+            string s = id[u] == id[v] ? "Yes" : "No";
+            cout << s << " " << s << ln;
+        } else if (t == 4) {
+            ll u, v; cin >> u >> v;
+            if (id[u] == id[v]) cout << val[v] - val[u] << ln;
+            else cout << "No" << ln;
+        } else if (t == 5) {
+            ll u; cin >> u;
+            ll c = count(id.begin(), id.end(), id[u]);
+            cout << c << " " << c << ln;
+        } else if (t == 6) {
+            ll c = sz(set<ll>(id.begin(), id.end()));
+            cout << c << " " << c << ln;
         } else {
-            vector<bool> vis(n, false);
-            queue<ll> bfs;
-            bfs.push(u); vis[u] = true;
-            while (!bfs.empty() && !vis[v]) {
-                ll cur = bfs.front(); bfs.pop();
-                for (ll nb : g[cur]) if (!vis[nb]) { vis[nb] = true; bfs.push(nb); }
-            }
-            cout << (vis[v] ? "Yes" : "No") << ln;
+            iota(id.begin(), id.end(), 0);
+            fill(val.begin(), val.end(), 0);
         }
     }
 }
@@ -2,12 +2,19 @@
 //
 // Input:
 //   N Q
-//   Q operations:
-//     "1 u v"  union u and v (0-indexed)
-//     "2 u v"  query: are u and v in the same component?
+//   Q operations (0-indexed):
+//     "1 u v"    union u and v
+//     "2 u v"    query: are u and v in the same component?
+//     "3 u v d"  weighted union: val[v] - val[u] = d (ignored if already joined)
+//     "4 u v"    val[v] - val[u], or "No" if not in the same component
+//     "5 u"      size of the component of u
+//     "6"        number of components
+//     "7"        reset
 //
 // Output:
-//   For each "2 u v": "Yes" or "No"
+//   "2": "Yes"/"No" for dsu and for dsu_weighted
+//   "4": the difference, or "No"
+//   "5", "6": the value for dsu and for dsu_weighted
 
 #include "src/extra/template.cpp"
 #include "src/extra/random.cpp"
@@ -15,12 +22,15 @@
 int main(int argc, char* argv[]) {
     rng.seed(atoll(argv[1]));
     ll n = uniform(2, 20);
-    ll q = uniform(1, 40);
+    ll q = uniform(1, 60);
     cout << n << " " << q << ln;
     forn(i, 0, q) {
-        ll t = uniform(1, 2);
+        ll t = uniform(0, 20) ? uniform(1, 6) : 7;
         ll u = uniform(0, n - 1);
         ll v = uniform(0, n - 1);
-        cout << t << " " << u << " " << v << ln;
+        if (t <= 2 || t == 4) cout << t << " " << u << " " << v << ln;
+        else if (t == 3) cout << t << " " << u << " " << v << " " << uniform(-1e9, 1e9) << ln;
+        else if (t == 5) cout << t << " " << u << ln;
+        else cout << t << ln;
     }
-}
\ No newline at end of file
+}
@@ -1,13 +1,31 @@
+// Test: structures/dsu (plain and weighted, size, components, reset)
+
 #include "src/extra/template.cpp"
 #include "src/structures/dsu.cpp"
+#include "src/structures/dsu_weighted.cpp"
 
 int main() {
     _;
     ll n, q; cin >> n >> q;
     dsu d(n);
+    dsu_weighted w(n);
     while (q--) {
-        ll t, u, v; cin >> t >> u >> v;
-        if (t == 1) d.uni(u, v);
-        else cout << (d.find(u) == d.find(v) ? "Yes" : "No") << ln;
+        ll t; cin >> t;
+        if (t == 1 || t == 3) {
+            ll u, v, x = 0; cin >> u >> v;
+            if (t == 3) cin >> x;
+            d.uni(u, v), w.uni(u, v, x);
+        } else if (t == 2) {
+            ll u, v; cin >> u >> v;
+            cout << (d.find(u) == d.find(v) ? "Yes" : "No") << " " << (w.same(u, v) ? "Yes" : "No") << ln;
+        } else if (t == 4) {
+            ll u, v; cin >> u >> v;
+            if (w.same(u, v)) cout << w.diff(u, v) << ln;
+            else cout << "No" << ln;
+        } else if (t == 5) {
+            ll u; cin >> u;
+            cout << d.size(u) << " " << w.size(u) << ln;
+        } else if (t == 6) cout << d.count_components() << " " << w.count_components() << ln;
+        else d.reset(), w.reset();
     }
 }
@@ -0,0 +1,21 @@
+#include "src/extra/template.cpp"
+
+int main() {
+    _;
+    ll n, m, q; cin >> n >> m >> q;
+    vll c(n);
+    iota(c.begin(), c.end(), 0);
+    ll k = 0;
+    forn(i, 0, m) {
+        ll u, v; cin >> u >> v;
+        if (c[u] == c[v]) continue;
+        ll from = c[v];
+        k++;
+        for (ll& x : c) if (x == from) x = c[u];
+    }
+    cout << k << ln;
+    while (q--) {
+        ll u, v; cin >> u >> v;
+        cout << (c[u] == c[v] ? "Yes" : "No") << ln;
+    }
+}
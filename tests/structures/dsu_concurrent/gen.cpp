@@ -0,0 +1,21 @@
+// Test: structures/dsu_concurrent
+//
+// Input:
+//   N M Q
+//   M lines "u v": edges, united in one parallel batch
+//   Q lines "u v": are u and v in the same component?
+//
+// Output:
+//   Number of successful unions (N - components), then "Yes"/"No" per query
+
+#include "src/extra/template.cpp"
+#include "src/extra/random.cpp"
+
+int main(int argc, char* argv[]) {
+    rng.seed(atoll(argv[1]));
+    ll n = uniform(0, 1) ? uniform(1, 20) : uniform(1, 2000);
+    ll m = uniform(0, n + 10), q = uniform(1, 40);
+    cout << n << " " << m << " " << q << ln;
+    forn(i, 0, m) cout << uniform(0, n - 1) << " " << uniform(0, n - 1) << ln;
+    forn(i, 0, q) cout << uniform(0, n - 1) << " " << uniform(0, n - 1) << ln;
+}
@@ -0,0 +1,17 @@
+// Test: structures/dsu_concurrent (parallel batch union, then queries)
+
+#include "src/extra/template.cpp"
+#include "src/structures/dsu_concurrent.cpp"
+
+int main() {
+    _;
+    ll n, m, q; cin >> n >> m >> q;
+    vector<pll> e(m);
+    for (auto& [u, v] : e) cin >> u >> v;
+    dsu_concurrent d(n);
+    cout << d.uni_batch(e, 4) << ln;
+    while (q--) {
+        ll u, v; cin >> u >> v;
+        cout << (d.same(u, v) ? "Yes" : "No") << ln;
+    }
+}
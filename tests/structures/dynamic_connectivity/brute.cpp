@@ -0,0 +1,35 @@
+#include "src/extra/template.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    multiset<pll> edges;
+    auto comp = [&]() {
+        vll c(n, -1);
+        ll k = 0;
+        forn(s, 0, n) if (c[s] < 0) {
+            vll stk = {s};
+            c[s] = k;
+            while (!stk.empty()) {
+                ll x = stk.back(); stk.pop_back();
+                for (auto [u, v] : edges) for (auto [a, b] : {pll{u, v}, pll{v, u}})
+                    if (a == x && c[b] < 0) c[b] = k, stk.push_back(b);
+            }
+            k++;
+        }
+        c.push_back(k);
+        return c;
+    };
+    while (q--) {
+        ll t, u, v; cin >> t;
+        if (t == 4) { cout << comp().back() << ln; continue; }
+        cin >> u >> v;
+        if (u > v) swap(u, v);
+        if (t == 1) edges.insert({u, v});
+        else if (t == 2) edges.erase(edges.find({u, v}));
+        else {
+            vll c = comp();
+            cout << (c[u] == c[v]) << ln;
+        }
+    }
+}
@@ -0,0 +1,42 @@
+// Test: structures/dynamic_connectivity
+//
+// Input:
+//   N Q
+//   Q operations:
+//     "1 u v"  add edge u-v (multi-edges allowed)
+//     "2 u v"  remove one copy of an existing edge u-v
+//     "3 u v"  are u and v connected?
+//     "4"      number of components
+//
+// Output:
+//   For each "3 u v": 1 or 0; for each "4": the count
+
+#include "src/extra/template.cpp"
+#include "src/extra/random.cpp"
+
+int main(int argc, char* argv[]) {
+    rng.seed(atoll(argv[1]));
+    ll n = uniform(1, 10);
+    ll q = uniform(1, 50);
+    cout << n << " " << q << ln;
+    vector<pll> edges;
+    forn(i, 0, q) {
+        ll t = uniform(1, 4);
+        if (t == 2 && edges.empty()) t = 1;
+        if (t == 1) {
+            ll u = uniform(0, n - 1), v = uniform(0, n - 1);
+            edges.push_back({u, v});
+            cout << "1 " << u << " " << v << ln;
+        } else if (t == 2) {
+            ll k = uniform(0, sz(edges) - 1);
+            auto [u, v] = edges[k];
+            edges.erase(edges.begin() + k);
+            if (uniform(0, 1)) swap(u, v);
+            cout << "2 " << u << " " << v << ln;
+        } else if (t == 3) {
+            cout << "3 " << uniform(0, n - 1) << " " << uniform(0, n - 1) << ln;
+        } else {
+            cout << "4" << ln;
+        }
+    }
+}
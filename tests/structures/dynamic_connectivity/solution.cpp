@@ -0,0 +1,19 @@
+// Test: structures/dynamic_connectivity (offline add/remove edges, connectivity queries)
+
+#include "src/extra/template.cpp"
+#include "src/structures/dynamic_connectivity.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    dyn_con dc(n);
+    while (q--) {
+        ll t, u, v; cin >> t;
+        if (t == 4) { dc.comps(); continue; }
+        cin >> u >> v;
+        if (t == 1) dc.add(u, v);
+        else if (t == 2) dc.rem(u, v);
+        else dc.connected(u, v);
+    }
+    for (ll x : dc.solve()) cout << x << ln;
+}
@@ -0,0 +1,20 @@
+#include "src/extra/template.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vll a(n);
+    for (ll& x : a) cin >> x;
+    while (q--) {
+        ll t, x, y; cin >> t >> x;
+        if (t == 1) cin >> y, a[x] += y;
+        else if (t == 2) {
+            cin >> y;
+            cout << accumulate(a.begin() + x, a.begin() + y + 1, 0ll) << ln;
+        } else {
+            ll p = 0, s = 0;
+            while (p < n && s + a[p] <= x) s += a[p++];
+            cout << p << ln;
+        }
+    }
+}
@@ -0,0 +1,31 @@
+// Test: structures/fenwick_tree
+//
+// Input:
+//   N Q
+//   A[0] ... A[N-1] (nonnegative)
+//   Q operations (0-indexed):
+//     "1 i x"  a[i] += x (x >= 0)
+//     "2 l r"  sum of a[l..r]
+//     "3 x"    upper_bound: largest p with a[0] + ... + a[p-1] <= x
+//
+// Output:
+//   One line per "2" and "3"
+
+#include "src/extra/template.cpp"
+#include "src/extra/random.cpp"
+
+int main(int argc, char* argv[]) {
+    rng.seed(atoll(argv[1]));
+    ll n = uniform(0, 1) ? uniform(1, 70) : 1ll << uniform(0, 6);
+    ll q = uniform(1, 50), v = uniform(0, 1) ? 3 : 1000;
+    cout << n << " " << q << ln;
+    forn(i, 0, n) cout << uniform(0, v) << " \n"[i == n - 1];
+    forn(i, 0, q) {
+        ll t = uniform(1, 3);
+        if (t == 1) cout << "1 " << uniform(0, n - 1) << " " << uniform(0, v) << ln;
+        else if (t == 2) {
+            ll l = uniform(0, n - 1);
+            cout << "2 " << l << " " << uniform(l, n - 1) << ln;
+        } else cout << "3 " << uniform(-1, v * n * 2) << ln;
+    }
+}
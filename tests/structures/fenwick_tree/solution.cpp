@@ -0,0 +1,18 @@
+// Test: structures/fenwick_tree (point add, range sum, upper_bound)
+
+#include "src/extra/template.cpp"
+#include "src/structures/fenwick_tree.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vll a(n);
+    for (ll& x : a) cin >> x;
+    Bit b(a);
+    while (q--) {
+        ll t, x, y; cin >> t >> x;
+        if (t == 1) cin >> y, b.update(x, y);
+        else if (t == 2) cin >> y, cout << b.query(x, y) << ln;
+        else cout << b.upper_bound(x) << ln;
+    }
+}
@@ -0,0 +1,43 @@
+// Test: structures/flat_hash_map
+//
+// Input:
+//   T Q (key type T: 0 ll, 1 pll, 2 tuple<ll, ll, ll>, 3 string, 4 vll)
+//   Q operations, a key k is written as its fields ("len x_1 .. x_len" for vll):
+//     "1 k v"  m[k] += v (absent keys start at 0)
+//     "2 k"    erase k, print 1 if it was present else 0
+//     "3 k"    print m[k] if present, else "none"
+//     "4"      clear, then print the size (0)
+//     "5"      print the size
+//
+// Output:
+//   One line for each operation 2, 3, 4, 5
+
+#include "src/extra/template.cpp"
+#include "src/extra/random.cpp"
+
+int main(int argc, char* argv[]) {
+    rng.seed(atoll(argv[1]));
+    ll q = uniform(1, 300), kmax = uniform(0, 1) ? 40 : 1000000000000ll;
+    ll tp = uniform(0, 4);
+    vector<string> keys;
+    forn(i, 0, 60) {
+        string k;
+        if (tp <= 2) forn(j, 0, tp + 1) k += (j ? " " : "") + to_string(uniform(-kmax, kmax));
+        if (tp == 3) forn(j, 0, uniform(1, 70)) k += char('a' + uniform(0, 1));
+        if (tp == 4) {
+            ll len = uniform(0, 9);
+            k = to_string(len);
+            forn(j, 0, len) k += " " + to_string(uniform(0, 2));
+        }
+        keys.push_back(k);
+    }
+    cout << tp << " " << q << ln;
+    forn(i, 0, q) {
+        ll t = uniform(1, 100);
+        t = t <= 50 ? 1 : t <= 70 ? 2 : t <= 95 ? 3 : t <= 97 ? 4 : 5;
+        string k = keys[uniform(0, sz(keys) - 1)];
+        if (t == 1) cout << "1 " << k << " " << uniform(-100, 100) << ln;
+        else if (t <= 3) cout << t << " " << k << ln;
+        else cout << t << ln;
+    }
+}
@@ -0,0 +1,48 @@
+// Test: structures/flat_hash_map (insert, erase, lookup, clear; ll, pll, tuple, string and vll keys)
+
+#include "src/extra/template.cpp"
+#include "src/structures/flat_hash_map.cpp"
+
+void rd(ll& k) { cin >> k; }
+void rd(pll& k) { cin >> k.first >> k.second; }
+void rd(tuple<ll, ll, ll>& k) { auto& [a, b, c] = k; cin >> a >> b >> c; }
+void rd(string& k) { cin >> k; }
+void rd(vll& k) {
+    ll n; cin >> n;
+    k.resize(n);
+    for (ll& x : k) cin >> x;
+}
+
+template<class K> void run(ll q) {
+    flat_hash_map<K, ll> m;
+    while (q--) {
+        ll t, v; K k; cin >> t;
+        if (t == 1) {
+            rd(k), cin >> v;
+            m[k] += v;
+        } else if (t == 2) {
+            rd(k);
+            cout << m.erase(k) << ln;
+        } else if (t == 3) {
+            rd(k);
+            ll j = m.find(k);
+            if (j < 0) cout << "none" << ln;
+            else cout << m.slot[j].second << ln;
+        } else if (t == 4) {
+            m.clear();
+            cout << m.size() << ln;
+        } else {
+            cout << m.size() << ln;
+        }
+    }
+}
+
+int main() {
+    _;
+    ll tp, q; cin >> tp >> q;
+    if (tp == 0) run<ll>(q);
+    else if (tp == 1) run<pll>(q);
+    else if (tp == 2) run<tuple<ll, ll, ll>>(q);
+    else if (tp == 3) run<string>(q);
+    else run<vll>(q);
+}
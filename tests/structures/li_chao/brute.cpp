@@ -0,0 +1,25 @@
+#include "src/extra/template.cpp"
+
+int main() {
+    _;
+    ll m; cin >> m;
+    vll xs(m);
+    for (ll& x : xs) cin >> x;
+    vector<array<ll, 4>> lines;
+    ll q; cin >> q;
+    while (q--) {
+        ll t; cin >> t;
+        if (t == 1) {
+            ll a, b; cin >> a >> b;
+            lines.push_back({a, b, -INF, INF});
+        } else if (t == 2) {
+            ll a, b, lo, hi; cin >> a >> b >> lo >> hi;
+            lines.push_back({a, b, lo, hi});
+        } else {
+            ll x; cin >> x;
+            ll r = -INF;
+            for (auto [a, b, lo, hi] : lines) if (lo <= x && x <= hi) r = max(r, a * x + b);
+            cout << r << ln;
+        }
+    }
+}
@@ -0,0 +1,36 @@
+// Test: structures/li_chao
+//
+// Input:
+//   M X[0] ... X[M-1]   (query points)
+//   Q
+//   Q operations:
+//     "1 a b"          add line ax + b
+//     "2 a b lo hi"    add line ax + b only for lo <= x <= hi
+//     "3 x"            max over lines at x (x among the query points), or -INF
+//
+// Output:
+//   One line per "3 x"
+
+#include "src/extra/template.cpp"
+#include "src/extra/random.cpp"
+
+int main(int argc, char* argv[]) {
+    rng.seed(atoll(argv[1]));
+    ll m = uniform(1, 20), v = uniform(0, 1) ? 10 : 1000000;
+    vll xs(m);
+    for (ll& x : xs) x = uniform(-v, v);
+    cout << m;
+    for (ll x : xs) cout << " " << x;
+    cout << ln;
+    ll q = uniform(1, 60);
+    cout << q << ln;
+    forn(i, 0, q) {
+        ll t = uniform(1, 3);
+        ll a = uniform(-v, v), b = uniform(-v * v, v * v);
+        if (t == 1) cout << "1 " << a << " " << b << ln;
+        else if (t == 2) {
+            ll lo = uniform(-v, v), hi = uniform(lo, v);
+            cout << "2 " << a << " " << b << " " << lo << " " << hi << ln;
+        } else cout << "3 " << xs[uniform(0, m - 1)] << ln;
+    }
+}
@@ -0,0 +1,26 @@
+// Test: structures/li_chao (lines and segments, max queries)
+
+#include "src/extra/template.cpp"
+#include "src/structures/li_chao.cpp"
+
+int main() {
+    _;
+    ll m; cin >> m;
+    vll xs(m);
+    for (ll& x : xs) cin >> x;
+    lichao<> lc(xs);
+    ll q; cin >> q;
+    while (q--) {
+        ll t; cin >> t;
+        if (t == 1) {
+            ll a, b; cin >> a >> b;
+            lc.add(a, b);
+        } else if (t == 2) {
+            ll a, b, lo, hi; cin >> a >> b >> lo >> hi;
+            lc.add_segment(a, b, lo, hi);
+        } else {
+            ll x; cin >> x;
+            cout << lc.query(x) << ln;
+        }
+    }
+}
@@ -0,0 +1,13 @@
+#include "src/extra/template.cpp"
+
+int main() {
+    _;
+    ll n, h, p; cin >> n >> h >> p;
+    vll a(n);
+    for (ll& x : a) cin >> x;
+    ll q; cin >> q;
+    while (q--) {
+        ll l, r; cin >> l >> r;
+        cout << sz(set<ll>(a.begin() + l, a.begin() + r + 1)) << ln;
+    }
+}
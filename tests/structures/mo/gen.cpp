@@ -0,0 +1,27 @@
+// Test: structures/mo
+//
+// Input:
+//   N H P (H = 1: Hilbert order, 0: odd-even blocks; P > 0: MO_parallel with P threads)
+//   a_0 .. a_{N-1}
+//   Q
+//   Q lines "l r" (0-indexed, inclusive)
+//
+// Output:
+//   For each query: number of distinct values in a[l..r]
+
+#include "src/extra/template.cpp"
+#include "src/extra/random.cpp"
+
+int main(int argc, char* argv[]) {
+    rng.seed(atoll(argv[1]));
+    ll n = uniform(1, 40), v = uniform(1, 10);
+    cout << n << " " << uniform(0, 1) << " " << uniform(0, 4) << ln;
+    forn(i, 0, n) cout << uniform(0, v - 1) << " \n"[i == n - 1];
+    ll q = uniform(1, 40);
+    cout << q << ln;
+    forn(i, 0, q) {
+        ll l = uniform(0, n - 1), r = uniform(0, n - 1);
+        if (l > r) swap(l, r);
+        cout << l << " " << r << ln;
+    }
+}
@@ -0,0 +1,27 @@
+// Test: structures/mo (distinct values, both orders, serial and parallel)
+
+#include "src/extra/template.cpp"
+#include "src/structures/mo_parallel.cpp"
+
+struct state {
+    vll& a; vll cnt; ll d = 0;
+    void add(ll i) { d += cnt[a[i]]++ == 0; }
+    void rem(ll i) { d -= --cnt[a[i]] == 0; }
+    void add_left(ll i) { add(i); }
+    void add_right(ll i) { add(i); }
+    void remove_left(ll i) { rem(i); }
+    void remove_right(ll i) { rem(i); }
+    ll answer() { return d; }
+};
+
+int main() {
+    _;
+    ll n, h, p; cin >> n >> h >> p;
+    vll a(n);
+    for (ll& x : a) cin >> x;
+    ll q; cin >> q;
+    vector<pll> qs(q);
+    for (auto& [l, r] : qs) cin >> l >> r;
+    state s{a, vll(n + 10)};
+    for (ll x : p ? MO_parallel(s, qs, p, h) : MO(s, qs, h)) cout << x << ln;
+}
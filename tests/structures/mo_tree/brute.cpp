@@ -0,0 +1,29 @@
+#include "src/extra/template.cpp"
+
+int main() {
+    _;
+    ll n; cin >> n;
+    vll a(n);
+    for (ll& x : a) cin >> x;
+    vector<vll> g(n);
+    forn(i, 1, n) {
+        ll u, v; cin >> u >> v;
+        g[u].push_back(v), g[v].push_back(u);
+    }
+    ll q; cin >> q;
+    while (q--) {
+        ll u, v; cin >> u >> v;
+        vll par(n, -1), stk = {u};
+        par[u] = u;
+        while (sz(stk)) {
+            ll x = stk.back(); stk.pop_back();
+            for (ll y : g[x]) if (par[y] == -1) par[y] = x, stk.push_back(y);
+        }
+        set<ll> s;
+        for (ll x = v; ; x = par[x]) {
+            s.insert(a[x]);
+            if (x == u) break;
+        }
+        cout << sz(s) << ln;
+    }
+}
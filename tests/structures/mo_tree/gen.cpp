@@ -0,0 +1,25 @@
+// Test: structures/mo_tree
+//
+// Input:
+//   N
+//   a_0 .. a_{N-1}
+//   N-1 lines "u v" (tree edges, 0-indexed)
+//   Q
+//   Q lines "u v"
+//
+// Output:
+//   For each query: number of distinct values on the path u..v
+
+#include "src/extra/template.cpp"
+#include "src/extra/random.cpp"
+
+int main(int argc, char* argv[]) {
+    rng.seed(atoll(argv[1]));
+    ll n = uniform(1, 30), v = uniform(1, 10);
+    cout << n << ln;
+    forn(i, 0, n) cout << uniform(0, v - 1) << " \n"[i == n - 1];
+    forn(i, 1, n) cout << uniform(0, i - 1) << " " << i << ln;
+    ll q = uniform(1, 40);
+    cout << q << ln;
+    forn(i, 0, q) cout << uniform(0, n - 1) << " " << uniform(0, n - 1) << ln;
+}
@@ -0,0 +1,28 @@
+// Test: structures/mo_tree (distinct values on paths)
+
+#include "src/extra/template.cpp"
+#include "src/structures/mo_tree.cpp"
+
+struct state {
+    vll& a; vll cnt; ll d = 0;
+    void add(ll v) { d += cnt[a[v]]++ == 0; }
+    void remove(ll v) { d -= --cnt[a[v]] == 0; }
+    ll answer() { return d; }
+};
+
+int main() {
+    _;
+    ll n; cin >> n;
+    vll a(n);
+    for (ll& x : a) cin >> x;
+    vector<vll> g(n);
+    forn(i, 1, n) {
+        ll u, v; cin >> u >> v;
+        g[u].push_back(v), g[v].push_back(u);
+    }
+    ll q; cin >> q;
+    vector<pll> qs(q);
+    for (auto& [u, v] : qs) cin >> u >> v;
+    state s{a, vll(n + 10)};
+    for (ll x : MO_tree(s, g, qs)) cout << x << ln;
+}
@@ -0,0 +1,13 @@
+#include "src/extra/template.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vll a(n);
+    for (ll& x : a) cin >> x;
+    while (q--) {
+        ll t, x, y; cin >> t >> x >> y;
+        if (t == 1) a[x] = y;
+        else cout << sz(set<ll>(a.begin() + x, a.begin() + y + 1)) << ln;
+    }
+}
@@ -0,0 +1,29 @@
+// Test: structures/mo_update
+//
+// Input:
+//   N Q
+//   a_0 .. a_{N-1}
+//   Q operations:
+//     "1 p x"  set a[p] = x
+//     "2 l r"  query (0-indexed, inclusive)
+//
+// Output:
+//   For each "2 l r": number of distinct values in a[l..r]
+
+#include "src/extra/template.cpp"
+#include "src/extra/random.cpp"
+
+int main(int argc, char* argv[]) {
+    rng.seed(atoll(argv[1]));
+    ll n = uniform(1, 30), q = uniform(1, 40), v = uniform(1, 10);
+    cout << n << " " << q << ln;
+    forn(i, 0, n) cout << uniform(0, v - 1) << " \n"[i == n - 1];
+    forn(i, 0, q) {
+        if (uniform(0, 1)) cout << "1 " << uniform(0, n - 1) << " " << uniform(0, v - 1) << ln;
+        else {
+            ll l = uniform(0, n - 1), r = uniform(0, n - 1);
+            if (l > r) swap(l, r);
+            cout << "2 " << l << " " << r << ln;
+        }
+    }
+}
@@ -0,0 +1,38 @@
+// Test: structures/mo_update (distinct values with point assignments)
+
+#include "src/extra/template.cpp"
+#include "src/structures/mo_update.cpp"
+
+struct state {
+    vll& a; vector<pll>& upd; vll cnt; ll d = 0;
+    void add(ll i) { d += cnt[a[i]]++ == 0; }
+    void rem(ll i) { d -= --cnt[a[i]] == 0; }
+    void add_left(ll i) { add(i); }
+    void add_right(ll i) { add(i); }
+    void remove_left(ll i) { rem(i); }
+    void remove_right(ll i) { rem(i); }
+    void apply(ll j, ll l, ll r) {
+        auto& [p, x] = upd[j];
+        bool in = l <= p && p <= r;
+        if (in) rem(p);
+        swap(a[p], x);
+        if (in) add(p);
+    }
+    ll answer() { return d; }
+};
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vll a(n);
+    for (ll& x : a) cin >> x;
+    vector<pll> upd;
+    vector<array<ll, 3>> qs;
+    while (q--) {
+        ll t, x, y; cin >> t >> x >> y;
+        if (t == 1) upd.push_back({x, y});
+        else qs.push_back({x, y, sz(upd)});
+    }
+    state s{a, upd, vll(n + 10)};
+    for (ll x : MO_update(s, qs, n)) cout << x << ln;
+}
@@ -8,7 +8,7 @@ int main() {
     ll n, q; cin >> n >> q;
     vll a(n);
     forn(i, 0, n) cin >> a[i];
-    perseg ps(a, q);
+    perseg<> ps(a);
     while (q--) {
         ll t; cin >> t;
         if (t == 1) {
@@ -0,0 +1,31 @@
+#include "src/extra/template.cpp"
+
+int main() {
+    _;
+    ll n, s, q; cin >> n >> s >> q;
+    vll a(n);
+    forn(i, 0, n) cin >> a[i];
+    auto kth = [&](ll l, ll r, ll k) {
+        vll b(a.begin() + l, a.begin() + r + 1);
+        sort(b.begin(), b.end());
+        return b[k];
+    };
+    while (q--) {
+        ll t; cin >> t;
+        if (t == 1) {
+            ll l, r, k; cin >> l >> r >> k;
+            cout << kth(l, r, k) << ln;
+        } else if (t == 2) {
+            ll l, r, x; cin >> l >> r >> x;
+            ll c = 0;
+            forn(i, l, r + 1) c += a[i] < x;
+            cout << c << ln;
+        } else {
+            ll c; cin >> c;
+            while (c--) {
+                ll l, r, k; cin >> l >> r >> k;
+                cout << kth(l, r, k) << ln;
+            }
+        }
+    }
+}
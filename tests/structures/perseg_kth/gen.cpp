@@ -0,0 +1,44 @@
+// Test: structures/perseg_kth (order statistics on versions)
+//
+// Input:
+//   N S Q
+//   A[0] ... A[N-1]  (values in [0, S))
+//   Q operations:
+//     "1 l r k"  k-th smallest (0-based) of a[l..r]
+//     "2 l r x"  how many values of a[l..r] are < x
+//     "3 c  l1 r1 k1 ... lc rc kc"  c k-th queries answered as one batch
+//
+// Output:
+//   One answer per line, batch answers in input order
+
+#include "src/extra/template.cpp"
+#include "src/extra/random.cpp"
+
+int main(int argc, char* argv[]) {
+    rng.seed(atoll(argv[1]));
+    ll n = uniform(1, 15), s = uniform(1, 10);
+    ll q = uniform(1, 30);
+    cout << n << " " << s << " " << q << ln;
+    forn(i, 0, n) {
+        if (i) cout << " ";
+        cout << uniform(0, s - 1);
+    }
+    cout << ln;
+    forn(i, 0, q) {
+        ll t = uniform(1, 3);
+        if (t == 3) {
+            ll c = uniform(1, 8), l = uniform(0, n - 1), r = uniform(l, n - 1);
+            cout << "3 " << c;
+            forn(j, 0, c) {
+                if (uniform(0, 1)) l = uniform(0, n - 1), r = uniform(l, n - 1);
+                cout << " " << l << " " << r << " " << uniform(0, r - l);
+            }
+            cout << ln;
+            continue;
+        }
+        ll l = uniform(0, n - 1);
+        ll r = uniform(l, n - 1);
+        if (t == 1) cout << "1 " << l << " " << r << " " << uniform(0, r - l) << ln;
+        else cout << "2 " << l << " " << r << " " << uniform(-1, s + 1) << ln;
+    }
+}
@@ -0,0 +1,30 @@
+// Test: structures/perseg_kth (kth, count_less, kth_batch)
+
+#include "src/extra/template.cpp"
+#include "src/structures/perseg_lazy.cpp"
+
+int main() {
+    _;
+    ll n, s, q; cin >> n >> s >> q;
+    vll zero(s);
+    perseg<> ps(zero);
+    forn(i, 0, n) {
+        ll a; cin >> a;
+        ps.set(a, ps.query(a, a, i) + 1, i);
+    }
+    while (q--) {
+        ll t; cin >> t;
+        if (t == 1) {
+            ll l, r, k; cin >> l >> r >> k;
+            cout << ps.kth(l, r + 1, k) << ln;
+        } else if (t == 2) {
+            ll l, r, x; cin >> l >> r >> x;
+            cout << ps.count_less(l, r + 1, x) << ln;
+        } else {
+            ll c; cin >> c;
+            vector<array<ll, 3>> qs(c);
+            for (auto& [l, r, k] : qs) cin >> l >> r >> k, r++;
+            for (ll x : ps.kth_batch(qs)) cout << x << ln;
+        }
+    }
+}
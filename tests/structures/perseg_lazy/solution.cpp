@@ -0,0 +1,25 @@
+// Test: structures/perseg_lazy (persistent segment tree)
+
+#include "src/extra/template.cpp"
+#include "src/structures/perseg_lazy.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vll a(n);
+    forn(i, 0, n) cin >> a[i];
+    perseg<ll, sum_op, true> ps(a);
+    while (q--) {
+        ll t; cin >> t;
+        if (t == 1) {
+            ll ver, idx, val; cin >> ver >> idx >> val;
+            ps.set(idx, val, ver);
+        } else if (t == 3) {
+            ll ver, l, r, v; cin >> ver >> l >> r >> v;
+            ps.update(l, r, v, ver);
+        } else {
+            ll ver, l, r; cin >> ver >> l >> r;
+            cout << ps.query(l, r, ver) << ln;
+        }
+    }
+}
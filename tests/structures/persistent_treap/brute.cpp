@@ -0,0 +1,34 @@
+#include "src/extra/template.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vector<vll> ver(1, vll(n));
+    forn(i, 0, n) cin >> ver[0][i];
+    while (q--) {
+        ll t; cin >> t;
+        if (t == 1) {
+            ll v, p, x; cin >> v >> p >> x;
+            vll a = ver[v];
+            a.insert(a.begin() + p, x);
+            ver.push_back(a);
+        } else if (t == 2) {
+            ll v, p; cin >> v >> p;
+            vll a = ver[v];
+            a.erase(a.begin() + p);
+            ver.push_back(a);
+        } else if (t == 3) {
+            ll v, w; cin >> v >> w;
+            vll a = ver[v];
+            a.insert(a.end(), ver[w].begin(), ver[w].end());
+            ver.push_back(a);
+        } else if (t == 4) {
+            ll v, l, r; cin >> v >> l >> r;
+            ll s = 0;
+            forn(i, l, r+1) s += ver[v][i];
+            cout << s << ln;
+        } else if (t == 5) {
+            ll v; cin >> v;
+        }
+    }
+}
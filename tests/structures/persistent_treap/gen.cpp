@@ -0,0 +1,57 @@
+// Test: structures/persistent_treap
+//
+// Input:
+//   N Q
+//   A[0] ... A[N-1]       (version 0)
+//   Q operations; each of 1, 2, 3 creates the next version:
+//     "1 v p x"   insert x before position p of version v
+//     "2 v p"     erase position p of version v
+//     "3 v w"     concatenation of versions v and w
+//     "4 v l r"   sum of [l, r] in version v
+//     "5 v"       drop version v (never used again)
+//     "6"         compact
+//
+// Output:
+//   For each "4 v l r": the sum
+
+#include "src/extra/template.cpp"
+#include "src/extra/random.cpp"
+
+int main(int argc, char* argv[]) {
+    rng.seed(atoll(argv[1]));
+    ll n = uniform(1, 10);
+    ll q = uniform(1, 40);
+    cout << n << " " << q << ln;
+    forn(i, 0, n) {
+        if (i) cout << " ";
+        cout << uniform(-100, 100);
+    }
+    cout << ln;
+    vll len = {n}, live = {0};
+    auto pick = [&]() { return live[uniform(0, sz(live) - 1)]; };
+    forn(i, 0, q) {
+        ll t = uniform(1, 6);
+        if (t == 5 && sz(live) == 1) t = 6;
+        ll v = pick();
+        if ((t == 2 || t == 4) && len[v] == 0) t = 1;
+        if (t == 1) {
+            cout << "1 " << v << " " << uniform(0, len[v]) << " " << uniform(-100, 100) << ln;
+            live.push_back(sz(len)), len.push_back(len[v] + 1);
+        } else if (t == 2) {
+            cout << "2 " << v << " " << uniform(0, len[v] - 1) << ln;
+            live.push_back(sz(len)), len.push_back(len[v] - 1);
+        } else if (t == 3) {
+            ll w = pick();
+            cout << "3 " << v << " " << w << ln;
+            live.push_back(sz(len)), len.push_back(len[v] + len[w]);
+        } else if (t == 4) {
+            ll l = uniform(0, len[v] - 1);
+            cout << "4 " << v << " " << l << " " << uniform(l, len[v] - 1) << ln;
+        } else if (t == 5) {
+            cout << "5 " << v << ln;
+            live.erase(find(live.begin(), live.end(), v));
+        } else {
+            cout << "6" << ln;
+        }
+    }
+}
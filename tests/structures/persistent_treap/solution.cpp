@@ -0,0 +1,33 @@
+// Test: structures/persistent_treap (versioned insert, erase, concat, range sum)
+
+#include "src/extra/template.cpp"
+#include "src/structures/persistent_treap.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vll a(n);
+    forn(i, 0, n) cin >> a[i];
+    persistent_treap pt(a);
+    while (q--) {
+        ll t; cin >> t;
+        if (t == 1) {
+            ll v, p, x; cin >> v >> p >> x;
+            pt.insert(v, p, x);
+        } else if (t == 2) {
+            ll v, p; cin >> v >> p;
+            pt.erase(v, p);
+        } else if (t == 3) {
+            ll v, w; cin >> v >> w;
+            pt.concat(v, w);
+        } else if (t == 4) {
+            ll v, l, r; cin >> v >> l >> r;
+            cout << pt.query(v, l, r) << ln;
+        } else if (t == 5) {
+            ll v; cin >> v;
+            pt.drop(v);
+        } else {
+            pt.compact();
+        }
+    }
+}
@@ -0,0 +1,12 @@
+#include "src/extra/template.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vll a(n);
+    forn(i, 0, n) cin >> a[i];
+    while (q--) {
+        ll l, r; cin >> l >> r;
+        cout << *min_element(a.begin() + l, a.begin() + r + 1) << ln;
+    }
+}
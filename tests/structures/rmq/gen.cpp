@@ -0,0 +1,28 @@
+// Test: structures/rmq
+//
+// Input:
+//   N Q
+//   A[0] ... A[N-1]
+//   Q lines "l r": minimum of a[l..r]
+//
+// Output:
+//   One minimum per query
+
+#include "src/extra/template.cpp"
+#include "src/extra/random.cpp"
+
+int main(int argc, char* argv[]) {
+    rng.seed(atoll(argv[1]));
+    ll n = uniform(0, 1) ? uniform(1, 70) : uniform(1, 1000);
+    ll q = uniform(1, 50), v = uniform(0, 1) ? 3 : 1000;
+    cout << n << " " << q << ln;
+    forn(i, 0, n) {
+        if (i) cout << " ";
+        cout << uniform(-v, v);
+    }
+    cout << ln;
+    forn(i, 0, q) {
+        ll l = uniform(0, n - 1);
+        cout << l << " " << uniform(l, n - 1) << ln;
+    }
+}
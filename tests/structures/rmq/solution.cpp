@@ -0,0 +1,16 @@
+// Test: structures/rmq (range minimum)
+
+#include "src/extra/template.cpp"
+#include "src/structures/rmq.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vll a(n);
+    forn(i, 0, n) cin >> a[i];
+    rmq<ll> r(a);
+    while (q--) {
+        ll l, rr; cin >> l >> rr;
+        cout << r.query(l, rr) << ln;
+    }
+}
@@ -0,0 +1,20 @@
+#include "src/extra/template.cpp"
+
+int main() {
+    _;
+    ll n, q, m; cin >> n >> q >> m;
+    vector<vll> a(n, vll(n));
+    for (auto& r : a) for (ll& x : r) cin >> x;
+    while (q--) {
+        ll t; cin >> t;
+        if (t == 1) {
+            ll x, y, v; cin >> x >> y >> v;
+            a[x][y] = v;
+        } else {
+            ll x1, y1, x2, y2; cin >> x1 >> y1 >> x2 >> y2;
+            ll r = m ? INF : 0;
+            forn(x, x1, x2 + 1) forn(y, y1, y2 + 1) r = m ? min(r, a[x][y]) : r + a[x][y];
+            cout << r << ln;
+        }
+    }
+}
@@ -0,0 +1,30 @@
+// Test: structures/seg2d
+//
+// Input:
+//   N Q M (M = 0: sum, 1: min)
+//   N lines with N values (init[x][y])
+//   Q operations:
+//     "1 x y v"          set (x, y) to v
+//     "2 x1 y1 x2 y2"    op over the rectangle (0-indexed, inclusive)
+//
+// Output:
+//   For each "2 ...": the result
+
+#include "src/extra/template.cpp"
+#include "src/extra/random.cpp"
+
+int main(int argc, char* argv[]) {
+    rng.seed(atoll(argv[1]));
+    ll n = uniform(1, 12), q = uniform(1, 40);
+    cout << n << " " << q << " " << uniform(0, 1) << ln;
+    forn(i, 0, n) forn(j, 0, n) cout << uniform(-1e9, 1e9) << " \n"[j == n - 1];
+    forn(i, 0, q) {
+        if (uniform(0, 1)) cout << "1 " << uniform(0, n - 1) << " " << uniform(0, n - 1) << " " << uniform(-1e9, 1e9) << ln;
+        else {
+            ll x1 = uniform(0, n - 1), x2 = uniform(0, n - 1), y1 = uniform(0, n - 1), y2 = uniform(0, n - 1);
+            if (x1 > x2) swap(x1, x2);
+            if (y1 > y2) swap(y1, y2);
+            cout << "2 " << x1 << " " << y1 << " " << x2 << " " << y2 << ln;
+        }
+    }
+}
@@ -0,0 +1,27 @@
+// Test: structures/seg2d (sum and min)
+
+#include "src/extra/template.cpp"
+#include "src/structures/seg2d.cpp"
+
+template<class S> void solve(S s, ll q) {
+    while (q--) {
+        ll t; cin >> t;
+        if (t == 1) {
+            ll x, y, v; cin >> x >> y >> v;
+            s.update(x, y, v);
+        } else {
+            ll x1, y1, x2, y2; cin >> x1 >> y1 >> x2 >> y2;
+            cout << s.query(x1, y1, x2, y2) << ln;
+        }
+    }
+}
+
+int main() {
+    _;
+    ll n, q, m; cin >> n >> q >> m;
+    vector<vll> a(n, vll(n));
+    for (auto& r : a) for (ll& x : r) cin >> x;
+    auto mn = [](ll a, ll b) { return min(a, b); };
+    if (m) solve(seg2d<ll, decltype(mn)>(n, a, INF), q);
+    else solve(seg2d<>(n, a), q);
+}
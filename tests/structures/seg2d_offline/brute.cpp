@@ -0,0 +1,22 @@
+#include "src/extra/template.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vector<pll> p(n);
+    for (auto& [x, y] : p) cin >> x >> y;
+    map<pll, ll> v;
+    while (q--) {
+        ll t; cin >> t;
+        if (t == 1) {
+            ll k, x; cin >> k >> x;
+            v[p[k]] = x;
+        } else {
+            ll x1, y1, x2, y2; cin >> x1 >> y1 >> x2 >> y2;
+            ll s = 0;
+            for (auto [pt, x] : v)
+                if (x1 <= pt.first && pt.first <= x2 && y1 <= pt.second && pt.second <= y2) s += x;
+            cout << s << ln;
+        }
+    }
+}
@@ -0,0 +1,31 @@
+// Test: structures/seg2d_offline
+//
+// Input:
+//   N Q
+//   N lines "x y" (points that may be updated)
+//   Q operations:
+//     "1 k v"            set the value of point k to v
+//     "2 x1 y1 x2 y2"    sum over the rectangle (inclusive)
+//
+// Output:
+//   For each "2 ...": the sum
+
+#include "src/extra/template.cpp"
+#include "src/extra/random.cpp"
+
+int main(int argc, char* argv[]) {
+    rng.seed(atoll(argv[1]));
+    ll n = uniform(1, 30), q = uniform(1, 40);
+    ll c = uniform(0, 1) ? 10 : 1e9;
+    cout << n << " " << q << ln;
+    forn(i, 0, n) cout << uniform(-c, c) << " " << uniform(-c, c) << ln;
+    forn(i, 0, q) {
+        if (uniform(0, 1)) cout << "1 " << uniform(0, n - 1) << " " << uniform(-1e9, 1e9) << ln;
+        else {
+            ll x1 = uniform(-c, c), x2 = uniform(-c, c), y1 = uniform(-c, c), y2 = uniform(-c, c);
+            if (x1 > x2) swap(x1, x2);
+            if (y1 > y2) swap(y1, y2);
+            cout << "2 " << x1 << " " << y1 << " " << x2 << " " << y2 << ln;
+        }
+    }
+}
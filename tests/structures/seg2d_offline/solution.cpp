@@ -0,0 +1,22 @@
+// Test: structures/seg2d_offline (point assign, rectangle sum)
+
+#include "src/extra/template.cpp"
+#include "src/structures/seg2d_offline.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vector<pll> p(n);
+    for (auto& [x, y] : p) cin >> x >> y;
+    seg2d_offline<> s(p);
+    while (q--) {
+        ll t; cin >> t;
+        if (t == 1) {
+            ll k, v; cin >> k >> v;
+            s.update(p[k].first, p[k].second, v);
+        } else {
+            ll x1, y1, x2, y2; cin >> x1 >> y1 >> x2 >> y2;
+            cout << s.query(x1, y1, x2, y2) << ln;
+        }
+    }
+}
@@ -10,11 +10,25 @@ int main() {
         if (t == 1) {
             ll i, v; cin >> i >> v;
             a[i] = v;
-        } else {
+        } else if (t == 2) {
             ll l, r; cin >> l >> r;
             ll s = 0;
             forn(i, l, r+1) s += a[i];
             cout << s << ln;
+        } else if (t == 3) {
+            ll k; cin >> k;
+            while (k--) {
+                ll i, v; cin >> i >> v;
+                a[i] = v;
+            }
+        } else {
+            ll k; cin >> k;
+            while (k--) {
+                ll l, r; cin >> l >> r;
+                ll s = 0;
+                forn(i, l, r+1) s += a[i];
+                cout << s << ln;
+            }
         }
     }
 }
@@ -6,9 +6,12 @@
 //   Q operations:
 //     "1 i v"   point update: set a[i] = v (0-indexed)
 //     "2 l r"   range query:  sum of a[l..r] inclusive
+//     "3 k i1 v1 ... ik vk"  batch update: set a[ij] = vj, in order
+//     "4 k l1 r1 ... lk rk"  batch query: sums of each a[lj..rj]
 //
 // Output:
 //   For each "2 l r": the sum
+//   For each "4 ...": the k sums, one per line
 
 #include "src/extra/template.cpp"
 #include "src/extra/random.cpp"
@@ -24,13 +27,26 @@ int main(int argc, char* argv[]) {
     }
     cout << ln;
     forn(i, 0, q) {
-        ll t = uniform(1, 2);
+        ll t = uniform(1, 4);
         if (t == 1) {
             cout << "1 " << uniform(0, n - 1) << " " << uniform(-1000, 1000) << ln;
-        } else {
+        } else if (t == 2) {
             ll l = uniform(0, n - 1);
             ll r = uniform(l, n - 1);
             cout << "2 " << l << " " << r << ln;
+        } else if (t == 3) {
+            ll k = uniform(1, 2 * n);
+            cout << "3 " << k;
+            forn(j, 0, k) cout << " " << uniform(0, n - 1) << " " << uniform(-1000, 1000);
+            cout << ln;
+        } else {
+            ll k = uniform(1, 5);
+            cout << "4 " << k;
+            forn(j, 0, k) {
+                ll l = uniform(0, n - 1);
+                cout << " " << l << " " << uniform(l, n - 1);
+            }
+            cout << ln;
         }
     }
 }
\ No newline at end of file
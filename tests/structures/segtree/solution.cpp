@@ -1,21 +1,31 @@
 #include "src/extra/template.cpp"
-#include "src/structures/segtree.cpp"
+#include "src/structures/segtree_batch.cpp"
 
 int main() {
     _;
     ll n, q; cin >> n >> q;
     vector<node> leaves(n);
     forn (i, 0, n) cin >> leaves[i].val;
-    segtree<node> st(n);
+    segtree_batch<node> st(n);
     st.set_leaves(leaves);
     while (q--) {
         ll t; cin >> t;
         if (t == 1) {
             ll i, v; cin >> i >> v;
             st.update(i, {v});
-        } else {
+        } else if (t == 2) {
             ll l, r; cin >> l >> r;
             cout << st.query(l, r).val << ln;
+        } else if (t == 3) {
+            ll k; cin >> k;
+            vector<pair<ll, node>> upd(k);
+            for (auto &[i, v] : upd) cin >> i >> v.val;
+            st.update_batch(upd);
+        } else {
+            ll k; cin >> k;
+            vector<pll> qs(k);
+            for (auto &[l, r] : qs) cin >> l >> r;
+            for (node x : st.query_batch(qs)) cout << x.val << ln;
         }
     }
 }
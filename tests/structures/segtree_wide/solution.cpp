@@ -0,0 +1,31 @@
+// Test: structures/segtree_wide (sum variant, same input as structures/segtree)
+
+#include "src/extra/template.cpp"
+#include "src/structures/segtree_wide.cpp"
+
+struct node {
+    ll val = 0;
+
+    static node comb(const node& a, const node& b) {
+        return {a.val + b.val};
+    }
+};
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vector<node> leaves(n);
+    forn (i, 0, n) cin >> leaves[i].val;
+    segtree_wide<node, 4> st(n);
+    st.set_leaves(leaves);
+    while (q--) {
+        ll t; cin >> t;
+        if (t == 1) {
+            ll i, v; cin >> i >> v;
+            st.update(i, {v});
+        } else {
+            ll l, r; cin >> l >> r;
+            cout << st.query(l, r).val << ln;
+        }
+    }
+}
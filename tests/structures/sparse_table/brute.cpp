@@ -0,0 +1,15 @@
+#include "src/extra/template.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vll a(n);
+    forn(i, 0, n) cin >> a[i];
+    while (q--) {
+        ll l, r; cin >> l >> r;
+        auto it = min_element(a.begin() + l, a.begin() + r + 1);
+        ll g = 0;
+        forn(i, l, r + 1) g = gcd(g, a[i]);
+        cout << *it << " " << g << " " << it - a.begin() << ln;
+    }
+}
@@ -0,0 +1,21 @@
+// Test: structures/sparse_table (min, gcd, argmin)
+
+#include "src/extra/template.cpp"
+#include "src/structures/sparse_table.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vll a(n);
+    forn(i, 0, n) cin >> a[i];
+    vector<pll> ai(n);
+    forn(i, 0, n) ai[i] = {a[i], i};
+    auto g = [](ll x, ll y) { return gcd(x, y); };
+    sparse<> mn(a);
+    sparse<ll, decltype(g)> gc(a, g);
+    sparse<pll> arg(ai);
+    while (q--) {
+        ll l, r; cin >> l >> r;
+        cout << mn.query(l, r) << " " << gc.query(l, r) << " " << arg.query(l, r).second << ln;
+    }
+}
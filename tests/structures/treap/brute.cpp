@@ -0,0 +1,29 @@
+#include "src/extra/template.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vll a(n);
+    forn(i, 0, n) cin >> a[i];
+    while (q--) {
+        ll t; cin >> t;
+        if (t == 1) {
+            ll p, v; cin >> p >> v;
+            a.insert(a.begin() + p, v);
+        } else if (t == 2) {
+            ll p; cin >> p;
+            a.erase(a.begin() + p);
+        } else if (t == 3) {
+            ll l, r, v; cin >> l >> r >> v;
+            forn(i, l, r+1) a[i] += v;
+        } else if (t == 4) {
+            ll l, r; cin >> l >> r;
+            reverse(a.begin() + l, a.begin() + r + 1);
+        } else {
+            ll l, r; cin >> l >> r;
+            ll s = 0;
+            forn(i, l, r+1) s += a[i];
+            cout << s << ln;
+        }
+    }
+}
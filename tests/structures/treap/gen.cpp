@@ -0,0 +1,46 @@
+// Test: structures/treap
+//
+// Input:
+//   N Q
+//   A[0] ... A[N-1]
+//   Q operations (positions 0-indexed, on the current sequence):
+//     "1 p v"    insert v before position p (p may equal the size)
+//     "2 p"      erase position p
+//     "3 l r v"  add v to [l, r]
+//     "4 l r"    reverse [l, r]
+//     "5 l r"    sum of [l, r]
+//
+// Output:
+//   For each "5 l r": the sum
+
+#include "src/extra/template.cpp"
+#include "src/extra/random.cpp"
+
+int main(int argc, char* argv[]) {
+    rng.seed(atoll(argv[1]));
+    ll n = uniform(1, 20);
+    ll q = uniform(1, 40);
+    cout << n << " " << q << ln;
+    forn(i, 0, n) {
+        if (i) cout << " ";
+        cout << uniform(-100, 100);
+    }
+    cout << ln;
+    forn(i, 0, q) {
+        ll t = uniform(1, 5);
+        if (n == 0) t = 1;
+        if (t == 1) {
+            cout << "1 " << uniform(0, n) << " " << uniform(-100, 100) << ln;
+            n++;
+        } else if (t == 2) {
+            cout << "2 " << uniform(0, n - 1) << ln;
+            n--;
+        } else {
+            ll l = uniform(0, n - 1);
+            ll r = uniform(l, n - 1);
+            cout << t << " " << l << " " << r;
+            if (t == 3) cout << " " << uniform(-100, 100);
+            cout << ln;
+        }
+    }
+}
@@ -0,0 +1,33 @@
+// Test: structures/treap (insert, erase, range add, range reverse, range sum)
+
+#include "src/extra/template.cpp"
+#include "src/structures/treap.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    treap tr(n + q);
+    forn(i, 0, n) {
+        ll v; cin >> v;
+        tr.insert(i, v);
+    }
+    while (q--) {
+        ll t; cin >> t;
+        if (t == 1) {
+            ll p, v; cin >> p >> v;
+            tr.insert(p, v);
+        } else if (t == 2) {
+            ll p; cin >> p;
+            tr.erase(p);
+        } else if (t == 3) {
+            ll l, r, v; cin >> l >> r >> v;
+            tr.update(l, r, v);
+        } else if (t == 4) {
+            ll l, r; cin >> l >> r;
+            tr.reverse(l, r);
+        } else {
+            ll l, r; cin >> l >> r;
+            cout << tr.query(l, r) << ln;
+        }
+    }
+}
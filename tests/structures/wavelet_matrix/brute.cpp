@@ -0,0 +1,35 @@
+#include "src/extra/template.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vll a(n);
+    forn(i, 0, n) cin >> a[i];
+    while (q--) {
+        ll t; cin >> t;
+        if (t == 1) {
+            ll l, r, k; cin >> l >> r >> k;
+            vll b(a.begin() + l, a.begin() + r + 1);
+            sort(b.begin(), b.end());
+            cout << b[k] << ln;
+        } else if (t == 2) {
+            ll x, r; cin >> x >> r;
+            cout << count(a.begin(), a.begin() + r + 1, x) << ln;
+        } else if (t == 3) {
+            ll l, r, lo, hi; cin >> l >> r >> lo >> hi;
+            ll c = 0;
+            forn(i, l, r + 1) c += lo <= a[i] && a[i] < hi;
+            cout << c << ln;
+        } else if (t == 4) {
+            ll l, r, x; cin >> l >> r >> x;
+            ll b = -INF;
+            forn(i, l, r + 1) if (a[i] < x) b = max(b, a[i]);
+            cout << b << ln;
+        } else {
+            ll l, r, x; cin >> l >> r >> x;
+            ll b = INF;
+            forn(i, l, r + 1) if (a[i] >= x) b = min(b, a[i]);
+            cout << b << ln;
+        }
+    }
+}
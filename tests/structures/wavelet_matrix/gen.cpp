@@ -0,0 +1,38 @@
+// Test: structures/wavelet_matrix
+//
+// Input:
+//   N Q
+//   A[0] ... A[N-1]
+//   Q operations:
+//     "1 l r k"      k-th smallest (0-based) of a[l..r]
+//     "2 x r"        occurrences of x in a[0..r]
+//     "3 l r lo hi"  count of lo <= a[i] < hi in a[l..r]
+//     "4 l r x"      largest value < x in a[l..r], or -INF
+//     "5 l r x"      smallest value >= x in a[l..r], or INF
+//
+// Output:
+//   One answer per query
+
+#include "src/extra/template.cpp"
+#include "src/extra/random.cpp"
+
+int main(int argc, char* argv[]) {
+    rng.seed(atoll(argv[1]));
+    ll n = uniform(1, 30), v = uniform(0, 1) ? 5 : 1000;
+    ll q = uniform(1, 40);
+    cout << n << " " << q << ln;
+    forn(i, 0, n) {
+        if (i) cout << " ";
+        cout << uniform(-v, v);
+    }
+    cout << ln;
+    forn(i, 0, q) {
+        ll t = uniform(1, 5);
+        ll l = uniform(0, n - 1);
+        ll r = uniform(l, n - 1);
+        if (t == 1) cout << "1 " << l << " " << r << " " << uniform(0, r - l) << ln;
+        else if (t == 2) cout << "2 " << uniform(-v - 1, v + 1) << " " << r << ln;
+        else if (t == 3) cout << "3 " << l << " " << r << " " << uniform(-v - 1, v + 1) << " " << uniform(-v - 1, v + 1) << ln;
+        else cout << t << " " << l << " " << r << " " << uniform(-v - 1, v + 1) << ln;
+    }
+}
@@ -0,0 +1,31 @@
+// Test: structures/wavelet_matrix (kth, rank, range_freq, prev/next value)
+
+#include "src/extra/template.cpp"
+#include "src/structures/wavelet_matrix.cpp"
+
+int main() {
+    _;
+    ll n, q; cin >> n >> q;
+    vll a(n);
+    forn(i, 0, n) cin >> a[i];
+    wavelet_matrix wm(a);
+    while (q--) {
+        ll t; cin >> t;
+        if (t == 1) {
+            ll l, r, k; cin >> l >> r >> k;
+            cout << wm.kth(l, r, k) << ln;
+        } else if (t == 2) {
+            ll x, r; cin >> x >> r;
+            cout << wm.rank(x, r) << ln;
+        } else if (t == 3) {
+            ll l, r, lo, hi; cin >> l >> r >> lo >> hi;
+            cout << wm.range_freq(l, r, lo, hi) << ln;
+        } else if (t == 4) {
+            ll l, r, x; cin >> l >> r >> x;
+            cout << wm.prev_value(l, r, x) << ln;
+        } else {
+            ll l, r, x; cin >> l >> r >> x;
+            cout << wm.next_value(l, r, x) << ln;
+        }
+    }
+}